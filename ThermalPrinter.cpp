@@ -74,9 +74,13 @@ struct Traits
     struct Printer
     {
         static constexpr unsigned long firmwareVersion = THERMAL_PRINTER_FIRMWARE;
+        static constexpr unsigned long firmwareGS      = 216; // first firmware with the GS command set
         static constexpr unsigned long serialBaudRate  = THERMAL_PRINTER_BAUDRATE;
         static constexpr unsigned long serialByteTime  = THERMAL_PRINTER_BYTETIME;
+        static constexpr unsigned long dotPrintTime    = THERMAL_PRINTER_DOTPRINTTIME;
+        static constexpr unsigned long dotFeedTime     = THERMAL_PRINTER_DOTFEEDTIME;
         static constexpr uint16_t      dotsPerLine     = 384;
+        static constexpr uint16_t      dotsPerMm       = 8;
     };
 
     struct FontA
@@ -97,6 +101,29 @@ struct Traits
         static constexpr uint8_t charHeight = 24;
     };
 
+    struct FontBanner
+    {
+        static constexpr uint8_t charWidth  = 5;
+        static constexpr uint8_t charHeight = 7;
+    };
+
+    static unsigned long byteTime(const unsigned long baudRate)
+    {
+        return ((8UL + 2UL) * 1000000UL) / baudRate;
+    }
+
+    static uint8_t capabilities(const unsigned long firmwareVersion)
+    {
+        typedef ThermalPrinterCapabilities Capabilities;
+
+        uint8_t capabilities = 0;
+        if(firmwareVersion >= Printer::firmwareGS) {
+            capabilities |= Capabilities::CAP_REVERSE_MODE;
+            capabilities |= Capabilities::CAP_UPSIDE_DOWN_MODE;
+        }
+        return capabilities;
+    }
+
     static uint8_t charWidth(const bool hasFontBit, const bool hasDoubleWidthBit)
     {
         const uint8_t baseCharWidth = (hasFontBit ? FontB::charWidth : FontA::charWidth);
@@ -138,8 +165,9 @@ struct Command
 
     struct Wake
     {
-        static constexpr uint8_t control  = 0xff;
-        static constexpr uint8_t function = 0x00;
+        static constexpr uint8_t       control  = 0xff;
+        static constexpr uint8_t       function = 0x00;
+        static constexpr unsigned long latency  = 50000UL; // microseconds
     };
 
     struct Sleep
@@ -173,6 +201,7 @@ struct Command
     {
         static constexpr uint8_t control  = ASCII::ESC;
         static constexpr uint8_t function = 'J';
+        static constexpr uint8_t maxRows  = 255;
 
         static uint8_t n1(const uint8_t rows)
         {
@@ -210,8 +239,11 @@ struct Command
 
     struct SetPrintingParameters
     {
-        static constexpr uint8_t control  = ASCII::ESC;
-        static constexpr uint8_t function = '7';
+        static constexpr uint8_t control         = ASCII::ESC;
+        static constexpr uint8_t function        = '7';
+        static constexpr uint8_t defaultDots     = 7;  // 64 dots
+        static constexpr uint8_t defaultTime     = 80; // 800 us
+        static constexpr uint8_t defaultInterval = 2;  // 20 us
 
         static uint8_t n1(const uint8_t dots)
         {
@@ -374,8 +406,9 @@ struct Command
 
     struct SetLineSpacing
     {
-        static constexpr uint8_t control  = ASCII::ESC;
-        static constexpr uint8_t function = '3';
+        static constexpr uint8_t control        = ASCII::ESC;
+        static constexpr uint8_t function       = '3';
+        static constexpr uint8_t defaultSpacing = 32;
 
         static uint8_t n1(const uint8_t spacing)
         {
@@ -409,13 +442,14 @@ struct Command
 
     struct SetBarcodeWidth
     {
-        static constexpr uint8_t control  = ASCII::GS;
-        static constexpr uint8_t function = 'w';
+        static constexpr uint8_t control      = ASCII::GS;
+        static constexpr uint8_t function     = 'w';
+        static constexpr uint8_t defaultWidth = 3;
 
         static uint8_t n1(const uint8_t width)
         {
             if((width < 2) || (width > 6)) {
-                return 3;
+                return defaultWidth;
             }
             return width;
         }
@@ -423,13 +457,14 @@ struct Command
 
     struct SetBarcodeHeight
     {
-        static constexpr uint8_t control  = ASCII::GS;
-        static constexpr uint8_t function = 'h';
+        static constexpr uint8_t control       = ASCII::GS;
+        static constexpr uint8_t function      = 'h';
+        static constexpr uint8_t defaultHeight = 162;
 
         static uint8_t n1(const uint8_t height)
         {
             if((height < 1) || (height > 254)) {
-                return 162;
+                return defaultHeight;
             }
             return height;
         }
@@ -461,10 +496,628 @@ struct Command
             return value;
         }
     };
+
+    struct PrintBitmap
+    {
+        static constexpr uint8_t control  = ASCII::DC2;
+        static constexpr uint8_t function = '*';
+
+        static uint8_t n1(const uint8_t rows)
+        {
+            return rows;
+        }
+
+        static uint8_t n2(const uint8_t bytes)
+        {
+            if(bytes > (Traits::Printer::dotsPerLine / 8)) {
+                return (Traits::Printer::dotsPerLine / 8);
+            }
+            return bytes;
+        }
+    };
+
+    struct GetPrinterId
+    {
+        static constexpr uint8_t control  = ASCII::GS;
+        static constexpr uint8_t function = 'I';
+        static constexpr uint8_t version  = 3;
+
+        static uint8_t n1(const uint8_t value)
+        {
+            return value;
+        }
+    };
+};
+
+}
+
+// ---------------------------------------------------------------------------
+// Barcode
+// ---------------------------------------------------------------------------
+
+namespace {
+
+struct Barcode
+{
+    typedef ThermalPrinterBarcodeSystem BarcodeSystem;
+
+    static constexpr uint8_t maxLength = 48; // wider symbols can not fit on the printing head
+
+    static bool isDigit(const uint8_t character)
+    {
+        return (character >= '0') && (character <= '9');
+    }
+
+    static bool isDigits(const char* data, const size_t length)
+    {
+        for(size_t index = 0; index < length; ++index) {
+            if(isDigit(data[index]) == false) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool isCode39(const uint8_t character)
+    {
+        if(isDigit(character) || ((character >= 'A') && (character <= 'Z'))) {
+            return true;
+        }
+        switch(character) {
+            case ' ':
+            case '$':
+            case '%':
+            case '*':
+            case '+':
+            case '-':
+            case '.':
+            case '/':
+                return true;
+            default:
+                break;
+        }
+        return false;
+    }
+
+    static bool isCodabar(const uint8_t character)
+    {
+        if(isDigit(character)) {
+            return true;
+        }
+        switch(character) {
+            case 'A': case 'B': case 'C': case 'D':
+            case 'a': case 'b': case 'c': case 'd':
+            case '$':
+            case '+':
+            case '-':
+            case '.':
+            case '/':
+            case ':':
+                return true;
+            default:
+                break;
+        }
+        return false;
+    }
+
+    static uint8_t checkDigit(const char* data, const size_t length)
+    {
+        unsigned int sum    = 0;
+        unsigned int weight = 3;
+        for(size_t index = length; index > 0; --index) {
+            sum   += (data[index - 1] - '0') * weight;
+            weight = (weight == 3 ? 1 : 3);
+        }
+        return '0' + ((10 - (sum % 10)) % 10);
+    }
+
+    static int copy(const char* data, const size_t length, uint8_t* buffer, const size_t capacity)
+    {
+        if(length > capacity) {
+            return -1;
+        }
+        ::memcpy(buffer, data, length);
+
+        return length;
+    }
+
+    static int frameModulo10(const char* data, const size_t length, const size_t digits, uint8_t* buffer, const size_t capacity)
+    {
+        if(isDigits(data, length) == false) {
+            return -1;
+        }
+        if(length == (digits - 1)) {
+            if(length >= capacity) {
+                return -1;
+            }
+            (void) copy(data, length, buffer, capacity);
+            buffer[length] = checkDigit(data, length);
+            return (length + 1);
+        }
+        if(length == digits) {
+            if(data[length - 1] != checkDigit(data, length - 1)) {
+                return -1;
+            }
+            return copy(data, length, buffer, capacity);
+        }
+        return -1;
+    }
+
+    static int frameInterleaved(const char* data, const size_t length, uint8_t* buffer, const size_t capacity)
+    {
+        if((length == 0) || (isDigits(data, length) == false)) {
+            return -1;
+        }
+        if((length % 2) != 0) {
+            if(length >= capacity) {
+                return -1;
+            }
+            (void) copy(data, length, buffer, capacity);
+            buffer[length] = checkDigit(data, length);
+            return (length + 1);
+        }
+        return copy(data, length, buffer, capacity);
+    }
+
+    static int frameCharset(const char* data, const size_t length, bool (*isValid)(const uint8_t), uint8_t* buffer, const size_t capacity)
+    {
+        if(length == 0) {
+            return -1;
+        }
+        for(size_t index = 0; index < length; ++index) {
+            if(isValid(data[index]) == false) {
+                return -1;
+            }
+        }
+        return copy(data, length, buffer, capacity);
+    }
+
+    static bool isAscii(const uint8_t character)
+    {
+        return (character <= 127);
+    }
+
+    static bool isCode128(const char* data, const size_t length)
+    {
+        uint8_t codeSet = 0;
+
+        for(size_t index = 0; index < length; ++index) {
+            const uint8_t character = data[index];
+            if(character == '{') {
+                if(++index == length) {
+                    return false;
+                }
+                switch(data[index]) {
+                    case 'A': // code set A
+                    case 'B': // code set B
+                    case 'C': // code set C
+                        codeSet = data[index];
+                        continue;
+                    case 'S': // shift
+                    case '1': // FNC1
+                    case '2': // FNC2
+                    case '3': // FNC3
+                    case '4': // FNC4
+                        continue;
+                    case '{': // escaped brace, only encodable in code set B
+                        if(codeSet == 'B') {
+                            continue;
+                        }
+                        return false;
+                    default:
+                        return false;
+                }
+            }
+            switch(codeSet) {
+                case 'A': // control characters, digits and uppercase letters
+                    if(character > 95) {
+                        return false;
+                    }
+                    break;
+                case 'B': // printable characters
+                    if((character < 32) || (character > 127)) {
+                        return false;
+                    }
+                    break;
+                case 'C': // pairs of digits
+                    if(character > 99) {
+                        return false;
+                    }
+                    break;
+                default:
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    static int frameCode128(const char* data, const size_t length, uint8_t* buffer, const size_t capacity)
+    {
+        if((length >= 3) && (data[0] == '{') && ((data[1] == 'A') || (data[1] == 'B') || (data[1] == 'C'))) {
+            if(isCode128(data, length) == false) {
+                return -1;
+            }
+            return copy(data, length, buffer, capacity);
+        }
+        if((length >= 4) && isDigits(data, length)) {
+            const size_t pairs = (length / 2);
+            const size_t extra = (length % 2);
+            const size_t count = (2 + pairs + (extra * 3));
+            if(count > capacity) {
+                return -1;
+            }
+            /* code set C for the digit pairs */ {
+                *buffer++ = '{';
+                *buffer++ = 'C';
+                for(size_t index = 0; index < pairs; ++index) {
+                    const uint8_t hi = (data[(index * 2) + 0] - '0');
+                    const uint8_t lo = (data[(index * 2) + 1] - '0');
+                    *buffer++ = ((hi * 10) + lo);
+                }
+            }
+            if(extra != 0) {
+                *buffer++ = '{';
+                *buffer++ = 'B';
+                *buffer++ = data[length - 1];
+            }
+            return count;
+        }
+        bool   codeA = (length != 0);
+        bool   codeB = (length != 0);
+        size_t count = (2 + length);
+        for(size_t index = 0; index < length; ++index) {
+            const uint8_t character = data[index];
+            codeA = codeA && (character <  96);
+            codeB = codeB && (character >= 32) && (character <= 127);
+            count = count + (character == '{' ? 1 : 0);
+        }
+        if(((codeA == false) && (codeB == false)) || (count > capacity)) {
+            return -1;
+        }
+        /* code set B if possible, else code set A */ {
+            *buffer++ = '{';
+            *buffer++ = (codeB ? 'B' : 'A');
+            for(size_t index = 0; index < length; ++index) {
+                const uint8_t character = data[index];
+                if(character == '{') {
+                    *buffer++ = '{';
+                }
+                *buffer++ = character;
+            }
+        }
+        return count;
+    }
+
+    struct Modules
+    {
+        unsigned int narrow; // narrow modules (or single-width modules)
+        unsigned int wide;   // wide modules of two-width symbologies
+    };
+
+    static Modules codabarModules(const uint8_t* buffer, const size_t length)
+    {
+        Modules modules = { 0, 0 };
+        for(size_t index = 0; index < length; ++index) {
+            const bool threeWide = ((isDigit(buffer[index]) == false)
+                                 && (buffer[index] != '-')
+                                 && (buffer[index] != '$'));
+            modules.narrow += (threeWide ? 4 : 5) + (index != 0 ? 1 : 0);
+            modules.wide   += (threeWide ? 3 : 2);
+        }
+        return modules;
+    }
+
+    static Modules code128Modules(const uint8_t* buffer, const size_t length)
+    {
+        unsigned int symbols = 0;
+        for(size_t index = 0; index < length; ++index) {
+            if((buffer[index] == '{') && ((index + 1) < length)) {
+                ++index;
+            }
+            ++symbols;
+        }
+        const Modules modules = { (11 * (symbols + 1)) + 13, 0 };
+
+        return modules;
+    }
+
+    static Modules modules(const uint8_t type, const uint8_t* buffer, const size_t length)
+    {
+        const unsigned int count = length;
+
+        switch(type) {
+            case BarcodeSystem::BS_UPC_A:
+                return Modules { 95, 0 };
+            case BarcodeSystem::BS_UPC_E:
+                return Modules { 51, 0 };
+            case BarcodeSystem::BS_EAN_13:
+                return Modules { 95, 0 };
+            case BarcodeSystem::BS_EAN_8:
+                return Modules { 67, 0 };
+            case BarcodeSystem::BS_CODE_39:
+                return Modules { (7 * (count + 2)) - 1, (3 * (count + 2)) };
+            case BarcodeSystem::BS_ITF:
+                return Modules { (3 * count) + 6, (2 * count) + 1 };
+            case BarcodeSystem::BS_CODABAR:
+                return codabarModules(buffer, length);
+            case BarcodeSystem::BS_CODE_93:
+                return Modules { (9 * (count + 4)) + 1, 0 };
+            case BarcodeSystem::BS_CODE_128:
+                return code128Modules(buffer, length);
+            default:
+                break;
+        }
+        return Modules { 0, 0 };
+    }
+
+    static bool fits(const Modules& modules, const uint8_t width)
+    {
+        const unsigned long narrowWidth = width;
+        const unsigned long wideWidth   = (((width * 5UL) + 1UL) / 2UL);
+        const unsigned long totalWidth  = (modules.narrow * narrowWidth)
+                                        + (modules.wide   * wideWidth);
+
+        return totalWidth <= Traits::Printer::dotsPerLine;
+    }
+
+    static int frame(const uint8_t type, const char* data, uint8_t* buffer, const size_t capacity)
+    {
+        const size_t length = ::strlen(data);
+
+        switch(type) {
+            case BarcodeSystem::BS_UPC_A:
+                return frameModulo10(data, length, 12, buffer, capacity);
+            case BarcodeSystem::BS_UPC_E:
+                return frameModulo10(data, length, 12, buffer, capacity);
+            case BarcodeSystem::BS_EAN_13:
+                return frameModulo10(data, length, 13, buffer, capacity);
+            case BarcodeSystem::BS_EAN_8:
+                return frameModulo10(data, length, 8, buffer, capacity);
+            case BarcodeSystem::BS_CODE_39:
+                return frameCharset(data, length, &isCode39, buffer, capacity);
+            case BarcodeSystem::BS_ITF:
+                return frameInterleaved(data, length, buffer, capacity);
+            case BarcodeSystem::BS_CODABAR:
+                return frameCharset(data, length, &isCodabar, buffer, capacity);
+            case BarcodeSystem::BS_CODE_93:
+                return frameCharset(data, length, &isAscii, buffer, capacity);
+            case BarcodeSystem::BS_CODE_128:
+                return frameCode128(data, length, buffer, capacity);
+            default:
+                break;
+        }
+        return -1;
+    }
+};
+
+}
+
+// ---------------------------------------------------------------------------
+// Markup
+// ---------------------------------------------------------------------------
+
+namespace {
+
+struct Markup
+{
+    static constexpr size_t maxLength = 8; // longest tag between the braces
+
+    static bool apply(ThermalPrinter& printer, const char* tag, size_t length)
+    {
+        const bool closing = ((length != 0) && (tag[0] == '/'));
+        const bool enabled = (closing == false);
+
+        if(closing != false) {
+            ++tag;
+            --length;
+        }
+        /* single letter tags */ {
+            if(length == 1) {
+                switch(tag[0]) {
+                    case 'b':
+                        printer.setEmphasizedMode(enabled);
+                        return true;
+                    case 's':
+                        printer.setSmallMode(enabled);
+                        return true;
+                    case 'i':
+                        printer.setReverseMode(enabled);
+                        return true;
+                    case 'x':
+                        printer.setDeleteLineMode(enabled);
+                        return true;
+                    case 'u':
+                        printer.setUnderlineMode(enabled ? 1 : 0);
+                        return true;
+                    case 'l':
+                    case 'c':
+                    case 'r':
+                        if(enabled == false) {
+                            return false;
+                        }
+                        printer.setJustification(tag[0] - 'a' + 'A');
+                        return true;
+                    default:
+                        return false;
+                }
+            }
+        }
+        /* double letter tags */ {
+            if((length == 2) && (tag[0] == 'd')) {
+                switch(tag[1]) {
+                    case 'w':
+                        printer.setDoubleWidthMode(enabled);
+                        return true;
+                    case 'h':
+                        printer.setDoubleHeightMode(enabled);
+                        return true;
+                    case 's':
+                        printer.setDoubleStrikeMode(enabled);
+                        return true;
+                    default:
+                        return false;
+                }
+            }
+        }
+        return false;
+    }
+};
+
+}
+
+// ---------------------------------------------------------------------------
+// Font (5x7, column-major, bit 0 is the top row, characters 0x20 to 0x7f)
+// ---------------------------------------------------------------------------
+
+namespace {
+
+const uint8_t font5x7[96][5] PROGMEM = {
+    { 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x5f, 0x00, 0x00 },
+    { 0x00, 0x07, 0x00, 0x07, 0x00 }, { 0x14, 0x7f, 0x14, 0x7f, 0x14 },
+    { 0x24, 0x2a, 0x7f, 0x2a, 0x12 }, { 0x23, 0x13, 0x08, 0x64, 0x62 },
+    { 0x36, 0x49, 0x55, 0x22, 0x50 }, { 0x00, 0x05, 0x03, 0x00, 0x00 },
+    { 0x00, 0x1c, 0x22, 0x41, 0x00 }, { 0x00, 0x41, 0x22, 0x1c, 0x00 },
+    { 0x08, 0x2a, 0x1c, 0x2a, 0x08 }, { 0x08, 0x08, 0x3e, 0x08, 0x08 },
+    { 0x00, 0x50, 0x30, 0x00, 0x00 }, { 0x08, 0x08, 0x08, 0x08, 0x08 },
+    { 0x00, 0x60, 0x60, 0x00, 0x00 }, { 0x20, 0x10, 0x08, 0x04, 0x02 },
+    { 0x3e, 0x51, 0x49, 0x45, 0x3e }, { 0x00, 0x42, 0x7f, 0x40, 0x00 },
+    { 0x42, 0x61, 0x51, 0x49, 0x46 }, { 0x21, 0x41, 0x45, 0x4b, 0x31 },
+    { 0x18, 0x14, 0x12, 0x7f, 0x10 }, { 0x27, 0x45, 0x45, 0x45, 0x39 },
+    { 0x3c, 0x4a, 0x49, 0x49, 0x30 }, { 0x01, 0x71, 0x09, 0x05, 0x03 },
+    { 0x36, 0x49, 0x49, 0x49, 0x36 }, { 0x06, 0x49, 0x49, 0x29, 0x1e },
+    { 0x00, 0x36, 0x36, 0x00, 0x00 }, { 0x00, 0x56, 0x36, 0x00, 0x00 },
+    { 0x08, 0x14, 0x22, 0x41, 0x00 }, { 0x14, 0x14, 0x14, 0x14, 0x14 },
+    { 0x00, 0x41, 0x22, 0x14, 0x08 }, { 0x02, 0x01, 0x51, 0x09, 0x06 },
+    { 0x32, 0x49, 0x79, 0x41, 0x3e }, { 0x7e, 0x11, 0x11, 0x11, 0x7e },
+    { 0x7f, 0x49, 0x49, 0x49, 0x36 }, { 0x3e, 0x41, 0x41, 0x41, 0x22 },
+    { 0x7f, 0x41, 0x41, 0x22, 0x1c }, { 0x7f, 0x49, 0x49, 0x49, 0x41 },
+    { 0x7f, 0x09, 0x09, 0x01, 0x01 }, { 0x3e, 0x41, 0x41, 0x51, 0x32 },
+    { 0x7f, 0x08, 0x08, 0x08, 0x7f }, { 0x00, 0x41, 0x7f, 0x41, 0x00 },
+    { 0x20, 0x40, 0x41, 0x3f, 0x01 }, { 0x7f, 0x08, 0x14, 0x22, 0x41 },
+    { 0x7f, 0x40, 0x40, 0x40, 0x40 }, { 0x7f, 0x02, 0x04, 0x02, 0x7f },
+    { 0x7f, 0x04, 0x08, 0x10, 0x7f }, { 0x3e, 0x41, 0x41, 0x41, 0x3e },
+    { 0x7f, 0x09, 0x09, 0x09, 0x06 }, { 0x3e, 0x41, 0x51, 0x21, 0x5e },
+    { 0x7f, 0x09, 0x19, 0x29, 0x46 }, { 0x46, 0x49, 0x49, 0x49, 0x31 },
+    { 0x01, 0x01, 0x7f, 0x01, 0x01 }, { 0x3f, 0x40, 0x40, 0x40, 0x3f },
+    { 0x1f, 0x20, 0x40, 0x20, 0x1f }, { 0x7f, 0x20, 0x18, 0x20, 0x7f },
+    { 0x63, 0x14, 0x08, 0x14, 0x63 }, { 0x03, 0x04, 0x78, 0x04, 0x03 },
+    { 0x61, 0x51, 0x49, 0x45, 0x43 }, { 0x00, 0x7f, 0x41, 0x41, 0x00 },
+    { 0x02, 0x04, 0x08, 0x10, 0x20 }, { 0x00, 0x41, 0x41, 0x7f, 0x00 },
+    { 0x04, 0x02, 0x01, 0x02, 0x04 }, { 0x40, 0x40, 0x40, 0x40, 0x40 },
+    { 0x00, 0x01, 0x02, 0x04, 0x00 }, { 0x20, 0x54, 0x54, 0x54, 0x78 },
+    { 0x7f, 0x48, 0x44, 0x44, 0x38 }, { 0x38, 0x44, 0x44, 0x44, 0x20 },
+    { 0x38, 0x44, 0x44, 0x48, 0x7f }, { 0x38, 0x54, 0x54, 0x54, 0x18 },
+    { 0x08, 0x7e, 0x09, 0x01, 0x02 }, { 0x08, 0x14, 0x54, 0x54, 0x3c },
+    { 0x7f, 0x08, 0x04, 0x04, 0x78 }, { 0x00, 0x44, 0x7d, 0x40, 0x00 },
+    { 0x20, 0x40, 0x44, 0x3d, 0x00 }, { 0x00, 0x7f, 0x10, 0x28, 0x44 },
+    { 0x00, 0x41, 0x7f, 0x40, 0x00 }, { 0x7c, 0x04, 0x18, 0x04, 0x78 },
+    { 0x7c, 0x08, 0x04, 0x04, 0x78 }, { 0x38, 0x44, 0x44, 0x44, 0x38 },
+    { 0x7c, 0x14, 0x14, 0x14, 0x08 }, { 0x08, 0x14, 0x14, 0x18, 0x7c },
+    { 0x7c, 0x08, 0x04, 0x04, 0x08 }, { 0x48, 0x54, 0x54, 0x54, 0x20 },
+    { 0x04, 0x3f, 0x44, 0x40, 0x20 }, { 0x3c, 0x40, 0x40, 0x20, 0x7c },
+    { 0x1c, 0x20, 0x40, 0x20, 0x1c }, { 0x3c, 0x40, 0x30, 0x40, 0x3c },
+    { 0x44, 0x28, 0x10, 0x28, 0x44 }, { 0x0c, 0x50, 0x50, 0x50, 0x3c },
+    { 0x44, 0x64, 0x54, 0x4c, 0x44 }, { 0x00, 0x08, 0x36, 0x41, 0x00 },
+    { 0x00, 0x00, 0x7f, 0x00, 0x00 }, { 0x00, 0x41, 0x36, 0x08, 0x00 },
+    { 0x08, 0x04, 0x08, 0x10, 0x08 }, { 0x7f, 0x7f, 0x7f, 0x7f, 0x7f },
+};
+
+}
+
+// ---------------------------------------------------------------------------
+// Guard
+// ---------------------------------------------------------------------------
+
+namespace {
+
+struct Guard
+{
+    Guard()
+    {
+        THERMAL_PRINTER_LOCK();
+    }
+
+   ~Guard()
+    {
+        THERMAL_PRINTER_UNLOCK();
+    }
 };
 
 }
 
+// ---------------------------------------------------------------------------
+// Job
+// ---------------------------------------------------------------------------
+
+class ThermalPrinter::Job
+{
+public: // public interface
+    Job(ThermalPrinter& printer)
+        : _printer(printer)
+    {
+        ++_printer._jobDepth;
+    }
+
+   ~Job()
+    {
+        --_printer._jobDepth;
+    }
+
+private: // private data
+    ThermalPrinter& _printer;
+};
+
+// ---------------------------------------------------------------------------
+// Trace
+// ---------------------------------------------------------------------------
+
+#if THERMAL_PRINTER_TRACE
+#define THERMAL_PRINTER_TRACE_SCOPE(name) const Trace trace(*this, F(name))
+#else
+#define THERMAL_PRINTER_TRACE_SCOPE(name) do {} while(0)
+#endif
+
+#if THERMAL_PRINTER_TRACE
+class ThermalPrinter::Trace
+{
+public: // public interface
+    Trace(ThermalPrinter& printer, const __FlashStringHelper* name)
+        : _printer(printer)
+        , _name(name)
+        , _bytes(printer._traceBytes)
+        , _enter(::micros())
+    {
+    }
+
+   ~Trace()
+    {
+        const unsigned long leave = ::micros();
+
+        const Guard guard;
+
+        /* record the event */ {
+            ThermalPrinterTraceEvent& event(_printer._traceEvents[_printer._traceIndex]);
+            event.name  = _name;
+            event.enter = _enter;
+            event.leave = leave;
+            event.bytes = (_printer._traceBytes - _bytes);
+        }
+        /* advance the ring buffer */ {
+            _printer._traceIndex = ((_printer._traceIndex + 1) % THERMAL_PRINTER_TRACE_EVENTS);
+            if(_printer._traceCount < THERMAL_PRINTER_TRACE_EVENTS) {
+                ++_printer._traceCount;
+            }
+        }
+    }
+
+private: // private data
+    ThermalPrinter&                  _printer;
+    const __FlashStringHelper* const _name;
+    const unsigned long              _bytes;
+    const unsigned long              _enter;
+};
+#endif
+
 // ---------------------------------------------------------------------------
 // ThermalPrinter
 // ---------------------------------------------------------------------------
@@ -472,34 +1125,86 @@ struct Command
 ThermalPrinter::ThermalPrinter(Stream& stream)
     : _stream(stream)
     , _deadline(0UL)
+    , _baudRate(Traits::Printer::serialBaudRate)
+    , _byteTime(Traits::Printer::serialByteTime)
+    , _dotPrintTime(Traits::Printer::dotPrintTime)
+    , _dotFeedTime(Traits::Printer::dotFeedTime)
+    , _position(0UL)
+#if THERMAL_PRINTER_AUTOWAKE
+    , _sleepTimeout(0UL)
+    , _lastActivity(0UL)
+#endif
+    , _pacing(true)
+    , _cancelled(false)
+    , _aborted(false)
+    , _inCommand(false)
+    , _jobDepth(0)
     , _printMode(0)
+    , _charSpacing(0)
+    , _barcodeLabel(0)
+    , _heatingDots(Command::SetPrintingParameters::defaultDots)
+    , _heatingTime(Command::SetPrintingParameters::defaultTime)
+    , _heatingInterval(Command::SetPrintingParameters::defaultInterval)
+    , _barcodeWidth(Command::SetBarcodeWidth::defaultWidth)
+    , _barcodeHeight(Command::SetBarcodeHeight::defaultHeight)
+    , _lineSpacing(Command::SetLineSpacing::defaultSpacing)
+    , _lineWidth(0)
+    , _firmwareVersion(Traits::Printer::firmwareVersion)
+    , _capabilities(Traits::capabilities(Traits::Printer::firmwareVersion))
+#if THERMAL_PRINTER_STATISTICS
+    , _statistics()
+#endif
+#if THERMAL_PRINTER_TRACE
+    , _traceEvents()
+    , _traceIndex(0)
+    , _traceCount(0)
+    , _traceBytes(0UL)
+#endif
 {
 }
 
-void ThermalPrinter::begin()
+void ThermalPrinter::begin(const bool detect)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("begin");
+
     reset();
+
+    if(detect != false) {
+        (void) detectFirmware();
+    }
 }
 
 void ThermalPrinter::reset()
 {
+    THERMAL_PRINTER_TRACE_SCOPE("reset");
+
     typedef Command::Reset command_traits;
 
     send ( command_traits::control
          , command_traits::function );
 
     /* reset properties */ {
-        _printMode = 0;
+        _printMode     = 0;
+        _charSpacing   = 0;
+        _barcodeLabel  = 0;
+        _barcodeWidth  = Command::SetBarcodeWidth::defaultWidth;
+        _barcodeHeight = Command::SetBarcodeHeight::defaultHeight;
+        _lineSpacing   = Command::SetLineSpacing::defaultSpacing;
+        _lineWidth     = 0;
     }
 }
 
 void ThermalPrinter::end()
 {
+    THERMAL_PRINTER_TRACE_SCOPE("end");
+
     reset();
 }
 
 void ThermalPrinter::printTestPage()
 {
+    THERMAL_PRINTER_TRACE_SCOPE("printTestPage");
+
     typedef Command::PrintTestPage command_traits;
 
     send ( command_traits::control
@@ -508,52 +1213,152 @@ void ThermalPrinter::printTestPage()
 
 void ThermalPrinter::wakePrinter()
 {
+    THERMAL_PRINTER_TRACE_SCOPE("wakePrinter");
+
     typedef Command::Wake command_traits;
 
+    const Guard guard;
+
     send ( command_traits::control
          , command_traits::function );
+
+    /* enforce the wake-up latency */ {
+        (void) waitAndSetNextTimeout(command_traits::latency);
+    }
 }
 
 void ThermalPrinter::sleepPrinter(const uint16_t seconds)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("sleepPrinter");
+
     typedef Command::Sleep command_traits;
 
     send ( command_traits::control
          , command_traits::function
          , command_traits::n1((seconds >> 0) & 0xff)
          , command_traits::n2((seconds >> 8) & 0xff) );
+
+#if THERMAL_PRINTER_AUTOWAKE
+    /* adjust the idle tracking */ {
+        _sleepTimeout = (static_cast<unsigned long>(seconds) * 1000UL);
+        _lastActivity = ::millis();
+    }
+#endif
 }
 
 void ThermalPrinter::feedLines(const uint8_t lines)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("feedLines");
+
     typedef Command::PrintAndFeedLines command_traits;
 
-    send ( command_traits::control
-         , command_traits::function
-         , command_traits::n1(lines) );
+    if(send ( command_traits::control
+            , command_traits::function
+            , command_traits::n1(lines) ) == false) {
+        return;
+    }
+    /* account for the paper movement */ {
+        advance(pendingLine(), (static_cast<unsigned long>(command_traits::n1(lines)) * lineHeight()));
+    }
 }
 
 void ThermalPrinter::feedRows(const uint8_t rows)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("feedRows");
+
     typedef Command::PrintAndFeedRows command_traits;
 
-    send ( command_traits::control
-         , command_traits::function
-         , command_traits::n1(rows) );
+    if(send ( command_traits::control
+            , command_traits::function
+            , command_traits::n1(rows) ) == false) {
+        return;
+    }
+    /* account for the paper movement */ {
+        advance(pendingLine(), command_traits::n1(rows));
+    }
 }
 
-void ThermalPrinter::setJustification(const uint8_t justification)
+void ThermalPrinter::feedDots(const uint16_t dots)
 {
-    typedef Command::SetJustification command_traits;
+    THERMAL_PRINTER_TRACE_SCOPE("feedDots");
 
-    send ( command_traits::control
-         , command_traits::function
-         , command_traits::n1(justification) );
-}
+    typedef Command::PrintAndFeedRows command_traits;
 
-void ThermalPrinter::setCharacterSet(const uint8_t number)
-{
-    typedef Command::SetCharacterSet command_traits;
+    const Guard guard;
+    const Job   job(*this);
+
+    unsigned long remaining = dots;
+    unsigned long fed       = 0UL;
+    while(remaining != 0UL) {
+        uint8_t buffer[3 * 8];
+        size_t  length = 0;
+        /* gather the maximal feed commands */ {
+            while((remaining != 0UL) && (length < sizeof(buffer))) {
+                const uint8_t rows = (remaining > command_traits::maxRows ? command_traits::maxRows : remaining);
+                buffer[length++] = command_traits::control;
+                buffer[length++] = command_traits::function;
+                buffer[length++] = command_traits::n1(rows);
+                remaining -= rows;
+            }
+        }
+        if(send(buffer, length) == false) {
+            break;
+        }
+        fed = (dots - remaining);
+    }
+    /* account for the whole paper movement at once */ {
+        if(fed != 0UL) {
+            advance(pendingLine(), fed);
+        }
+    }
+}
+
+void ThermalPrinter::feedToLength(const uint16_t length)
+{
+    THERMAL_PRINTER_TRACE_SCOPE("feedToLength");
+
+    const unsigned long target = (static_cast<unsigned long>(length) * Traits::Printer::dotsPerMm);
+
+    const Guard guard;
+    const Job   job(*this);
+
+    while((_position < target) && (abortIfCancelled() == false)) {
+        const unsigned long start = (_position + (_lineWidth != 0 ? charHeight() : 0));
+        if(start >= target) {
+            feedRows(0);
+            continue;
+        }
+        const unsigned long dots = (target - start);
+        feedDots(dots > 0xffffUL ? 0xffff : dots);
+    }
+}
+
+unsigned long ThermalPrinter::getPosition() const
+{
+    return _position;
+}
+
+void ThermalPrinter::resetPosition()
+{
+    _position = 0UL;
+}
+
+void ThermalPrinter::setJustification(const uint8_t justification)
+{
+    THERMAL_PRINTER_TRACE_SCOPE("setJustification");
+
+    typedef Command::SetJustification command_traits;
+
+    send ( command_traits::control
+         , command_traits::function
+         , command_traits::n1(justification) );
+}
+
+void ThermalPrinter::setCharacterSet(const uint8_t number)
+{
+    THERMAL_PRINTER_TRACE_SCOPE("setCharacterSet");
+
+    typedef Command::SetCharacterSet command_traits;
 
     send ( command_traits::control
          , command_traits::function
@@ -562,6 +1367,8 @@ void ThermalPrinter::setCharacterSet(const uint8_t number)
 
 void ThermalPrinter::setCharacterPage(const uint8_t number)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("setCharacterPage");
+
     typedef Command::SetCharacterPage  command_traits;
 
     send ( command_traits::control
@@ -571,35 +1378,67 @@ void ThermalPrinter::setCharacterPage(const uint8_t number)
 
 void ThermalPrinter::setCharacterSpacing(const uint8_t spacing)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("setCharacterSpacing");
+
     typedef Command::SetCharacterSpacing  command_traits;
 
-    send ( command_traits::control
-         , command_traits::function
-         , command_traits::n1(spacing) );
+    if(send ( command_traits::control
+            , command_traits::function
+            , command_traits::n1(spacing) ) == false) {
+        return;
+    }
+    /* adjust the shadow value */ {
+        _charSpacing = command_traits::n1(spacing);
+    }
 }
 
 void ThermalPrinter::setLineSpacing(const uint8_t spacing)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("setLineSpacing");
+
     typedef Command::SetLineSpacing  command_traits;
 
-    send ( command_traits::control
-         , command_traits::function
-         , command_traits::n1(spacing) );
+    if(send ( command_traits::control
+            , command_traits::function
+            , command_traits::n1(spacing) ) == false) {
+        return;
+    }
+    /* adjust the shadow value */ {
+        _lineSpacing = command_traits::n1(spacing);
+    }
 }
 
 void ThermalPrinter::setPrintingParameters(const uint8_t dots, const uint8_t time, const uint8_t interval)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("setPrintingParameters");
+
     typedef Command::SetPrintingParameters command_traits;
 
-    send ( command_traits::control
-         , command_traits::function
-         , command_traits::n1(dots)
-         , command_traits::n2(time)
-         , command_traits::n3(interval) );
+    if(send ( command_traits::control
+            , command_traits::function
+            , command_traits::n1(dots)
+            , command_traits::n2(time)
+            , command_traits::n3(interval) ) == false) {
+        return;
+    }
+    /* adjust the shadow values */ {
+        _heatingDots     = dots;
+        _heatingTime     = time;
+        _heatingInterval = interval;
+    }
+}
+
+void ThermalPrinter::getPrintingParameters(uint8_t& dots, uint8_t& time, uint8_t& interval) const
+{
+    dots     = _heatingDots;
+    time     = _heatingTime;
+    interval = _heatingInterval;
 }
 
 void ThermalPrinter::setPrintingDensity(const uint8_t density, const uint8_t breaktime)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("setPrintingDensity");
+
     typedef Command::SetPrintingDensity command_traits;
 
     send ( command_traits::control
@@ -609,6 +1448,8 @@ void ThermalPrinter::setPrintingDensity(const uint8_t density, const uint8_t bre
 
 void ThermalPrinter::setOnline(const bool online)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("setOnline");
+
     typedef Command::SetPeripheralDevice command_traits;
 
     send ( command_traits::control
@@ -618,12 +1459,17 @@ void ThermalPrinter::setOnline(const bool online)
 
 void ThermalPrinter::setPrintMode(const uint8_t printMode)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("setPrintMode");
+
     typedef Command::SetPrintMode command_traits;
 
-    send ( command_traits::control
-         , command_traits::function
-         , command_traits::n1(printMode) );
+    const Guard guard;
 
+    if(send ( command_traits::control
+            , command_traits::function
+            , command_traits::n1(printMode) ) == false) {
+        return;
+    }
     /* adjust the shadow value */ {
         _printMode = printMode;
     }
@@ -631,8 +1477,12 @@ void ThermalPrinter::setPrintMode(const uint8_t printMode)
 
 void ThermalPrinter::setSmallMode(const bool enabled)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("setSmallMode");
+
     typedef Command::SetPrintMode command_traits;
 
+    const Guard guard;
+
     setPrintMode ( enabled != false
                  ? _printMode |  command_traits::bit0
                  : _printMode & ~command_traits::bit0 );
@@ -640,13 +1490,17 @@ void ThermalPrinter::setSmallMode(const bool enabled)
 
 void ThermalPrinter::setReverseMode(const bool enabled)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("setReverseMode");
+
     typedef Command::SetPrintMode command_traits;
 
+    const Guard guard;
+
     setPrintMode ( enabled != false
                  ? _printMode |  command_traits::bit1
                  : _printMode & ~command_traits::bit1 );
 
-    if(Traits::Printer::firmwareVersion >= 216) {
+    if((_capabilities & ThermalPrinterCapabilities::CAP_REVERSE_MODE) != 0) {
         typedef Command::SetReverseMode command_traits;
 
         send ( command_traits::control
@@ -657,13 +1511,17 @@ void ThermalPrinter::setReverseMode(const bool enabled)
 
 void ThermalPrinter::setUpsideDownMode(const bool enabled)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("setUpsideDownMode");
+
     typedef Command::SetPrintMode command_traits;
 
+    const Guard guard;
+
     setPrintMode ( enabled != false
                  ? _printMode |  command_traits::bit2
                  : _printMode & ~command_traits::bit2 );
 
-    if(Traits::Printer::firmwareVersion >= 216) {
+    if((_capabilities & ThermalPrinterCapabilities::CAP_UPSIDE_DOWN_MODE) != 0) {
         typedef Command::SetUpsideDownMode command_traits;
 
         send ( command_traits::control
@@ -674,8 +1532,12 @@ void ThermalPrinter::setUpsideDownMode(const bool enabled)
 
 void ThermalPrinter::setEmphasizedMode(const bool enabled)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("setEmphasizedMode");
+
     typedef Command::SetPrintMode command_traits;
 
+    const Guard guard;
+
     setPrintMode ( enabled != false
                  ? _printMode |  command_traits::bit3
                  : _printMode & ~command_traits::bit3 );
@@ -683,8 +1545,12 @@ void ThermalPrinter::setEmphasizedMode(const bool enabled)
 
 void ThermalPrinter::setDoubleHeightMode(const bool enabled)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("setDoubleHeightMode");
+
     typedef Command::SetPrintMode command_traits;
 
+    const Guard guard;
+
     setPrintMode ( enabled != false
                  ? _printMode |  command_traits::bit4
                  : _printMode & ~command_traits::bit4 );
@@ -692,8 +1558,12 @@ void ThermalPrinter::setDoubleHeightMode(const bool enabled)
 
 void ThermalPrinter::setDoubleWidthMode(const bool enabled)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("setDoubleWidthMode");
+
     typedef Command::SetPrintMode command_traits;
 
+    const Guard guard;
+
     setPrintMode ( enabled != false
                  ? _printMode |  command_traits::bit5
                  : _printMode & ~command_traits::bit5 );
@@ -701,8 +1571,12 @@ void ThermalPrinter::setDoubleWidthMode(const bool enabled)
 
 void ThermalPrinter::setDeleteLineMode(const bool enabled)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("setDeleteLineMode");
+
     typedef Command::SetPrintMode command_traits;
 
+    const Guard guard;
+
     setPrintMode ( enabled != false
                  ? _printMode |  command_traits::bit6
                  : _printMode & ~command_traits::bit6 );
@@ -710,6 +1584,8 @@ void ThermalPrinter::setDeleteLineMode(const bool enabled)
 
 void ThermalPrinter::setDoubleStrikeMode(const bool enabled)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("setDoubleStrikeMode");
+
     typedef Command::SetDoubleStrikeMode command_traits;
 
     send ( command_traits::control
@@ -719,6 +1595,8 @@ void ThermalPrinter::setDoubleStrikeMode(const bool enabled)
 
 void ThermalPrinter::setUnderlineMode(const uint8_t mode)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("setUnderlineMode");
+
     typedef Command::SetUnderlineMode command_traits;
 
     send ( command_traits::control
@@ -728,84 +1606,244 @@ void ThermalPrinter::setUnderlineMode(const uint8_t mode)
 
 void ThermalPrinter::setBarcodeLabel(const uint8_t label)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("setBarcodeLabel");
+
     typedef Command::SetBarcodeLabel command_traits;
 
-    send ( command_traits::control
-         , command_traits::function
-         , command_traits::n1(label) );
+    if(send ( command_traits::control
+            , command_traits::function
+            , command_traits::n1(label) ) == false) {
+        return;
+    }
+    /* adjust the shadow value */ {
+        _barcodeLabel = (command_traits::n1(label) & 0x3);
+    }
 }
 
 void ThermalPrinter::setBarcodeWidth(const uint8_t width)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("setBarcodeWidth");
+
     typedef Command::SetBarcodeWidth command_traits;
 
-    send ( command_traits::control
-         , command_traits::function
-         , command_traits::n1(width) );
+    if(send ( command_traits::control
+            , command_traits::function
+            , command_traits::n1(width) ) == false) {
+        return;
+    }
+    /* adjust the shadow value */ {
+        _barcodeWidth = command_traits::n1(width);
+    }
 }
 
 void ThermalPrinter::setBarcodeHeight(const uint8_t height)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("setBarcodeHeight");
+
     typedef Command::SetBarcodeHeight command_traits;
 
-    send ( command_traits::control
-         , command_traits::function
-         , command_traits::n1(height) );
+    if(send ( command_traits::control
+            , command_traits::function
+            , command_traits::n1(height) ) == false) {
+        return;
+    }
+    /* adjust the shadow value */ {
+        _barcodeHeight = command_traits::n1(height);
+    }
 }
 
-void ThermalPrinter::printBarcode(const char* data, const uint8_t type)
+bool ThermalPrinter::printBarcode(const char* data, const uint8_t type)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("printBarcode");
+
     typedef Command::PrintBarcode command_traits;
 
-    send ( command_traits::control
-         , command_traits::function
-         , command_traits::n1(type)
-         , command_traits::n2(::strlen(data)) );
-
-    /* send characters */ {
-        int sent = 0;
-        while(sent < 255) {
-            const char character = *data;
-            if(character == ASCII::NUL) {
-                break;
+    uint8_t   buffer[4 + Barcode::maxLength];
+    const int length = Barcode::frame(type, data, &buffer[4], Barcode::maxLength);
+
+    if(length < 0) {
+        return false;
+    }
+    if(Barcode::fits(Barcode::modules(type, &buffer[4], length), _barcodeWidth) == false) {
+        return false;
+    }
+    /* frame the command */ {
+        buffer[0] = command_traits::control;
+        buffer[1] = command_traits::function;
+        buffer[2] = command_traits::n1(type);
+        buffer[3] = command_traits::n2(length);
+    }
+    if(send(buffer, (4 + length))) {
+        const uint8_t labels = (((_barcodeLabel & 0x1) != 0) + ((_barcodeLabel & 0x2) != 0));
+        advance((_barcodeHeight + (labels * Traits::FontA::charHeight)), 0UL);
+    }
+    return true;
+}
+
+bool ThermalPrinter::printBarcode(const __FlashStringHelper* data, const uint8_t type)
+{
+    THERMAL_PRINTER_TRACE_SCOPE("printBarcode");
+
+    PGM_P pointer = reinterpret_cast<PGM_P>(data);
+    char  buffer[Barcode::maxLength + 1];
+
+    for(size_t length = 0; length < sizeof(buffer); ++length) {
+        buffer[length] = pgm_read_byte(pointer++);
+        if(buffer[length] == ASCII::NUL) {
+            return printBarcode(buffer, type);
+        }
+    }
+    return false;
+}
+
+uint8_t ThermalPrinter::fitBarcodeWidth(const char* data, const uint8_t type)
+{
+    THERMAL_PRINTER_TRACE_SCOPE("fitBarcodeWidth");
+
+    typedef ThermalPrinterBarcodeSystem BarcodeSystem;
+
+    uint8_t   buffer[Barcode::maxLength];
+    const int length = Barcode::frame(type, data, buffer, Barcode::maxLength);
+
+    if(length >= 0) {
+        const Barcode::Modules modules(Barcode::modules(type, buffer, length));
+        for(uint8_t width = BarcodeSystem::BS_WIDTH_HUGE; width >= BarcodeSystem::BS_WIDTH_TINY; --width) {
+            if(Barcode::fits(modules, width)) {
+                return width;
             }
-            else {
-                send(character);
-                ++sent;
-                ++data;
+        }
+    }
+    return 0;
+}
+
+void ThermalPrinter::printMarkup(const char* markup)
+{
+    THERMAL_PRINTER_TRACE_SCOPE("printMarkup");
+
+    const Guard guard;
+    const Job   job(*this);
+
+    size_t consumed = 0;
+
+    (void) printMarkup(markup, ::strlen(markup), true, consumed);
+}
+
+void ThermalPrinter::printMarkup(const __FlashStringHelper* markup)
+{
+    THERMAL_PRINTER_TRACE_SCOPE("printMarkup");
+
+    const Guard guard;
+    const Job   job(*this);
+
+    PGM_P  pointer = reinterpret_cast<PGM_P>(markup);
+    char   buffer[32];
+    size_t length  = 0;
+    bool   last    = false;
+
+    while(last == false) {
+        /* complete the chunk from the flash string */ {
+            while(length < sizeof(buffer)) {
+                const char character = pgm_read_byte(pointer);
+                if(character == ASCII::NUL) {
+                    last = true;
+                    break;
+                }
+                buffer[length++] = character;
+                ++pointer;
             }
         }
+        size_t consumed = 0;
+        if(printMarkup(buffer, length, last, consumed) == false) {
+            return;
+        }
+        /* carry a tag straddling the chunk boundary over to the next chunk */ {
+            length -= consumed;
+            ::memmove(buffer, &buffer[consumed], length);
+        }
     }
 }
 
-int ThermalPrinter::hasPaper()
+void ThermalPrinter::printBanner(const char* text, const uint8_t scale)
 {
-    /* flush input */ {
-        while(_stream.available()) {
-            (void) _stream.read();
+    THERMAL_PRINTER_TRACE_SCOPE("printBanner");
+
+    typedef Traits::FontBanner     font_traits;
+    typedef Command::PrintBitmap   command_traits;
+
+    constexpr unsigned int maxScale = (Traits::Printer::dotsPerLine / font_traits::charHeight);
+    const     unsigned int dotScale = (scale == 0 ? 1 : (scale > maxScale ? maxScale : scale));
+    const     unsigned int height   = (font_traits::charHeight * dotScale);
+    const     unsigned int offset   = ((Traits::Printer::dotsPerLine - height) / 2);
+    const     uint8_t      bytes    = command_traits::n2((offset + height + 7) / 8);
+
+    const Guard guard;
+    const Job   job(*this);
+
+    for(; *text != ASCII::NUL; ++text) {
+        const uint8_t character = static_cast<uint8_t>(*text);
+        const uint8_t glyph     = ((character >= 0x20) && (character < 0x7f) ? (character - 0x20) : 0x00);
+        for(uint8_t column = 0; column < font_traits::charWidth; ++column) {
+            uint8_t band[Traits::Printer::dotsPerLine / 8] = { 0 };
+            /* rasterize the glyph column, top of the glyph on the right */ {
+                const uint8_t bits = pgm_read_byte(&font5x7[glyph][column]);
+                for(uint8_t row = 0; row < font_traits::charHeight; ++row) {
+                    if((bits & (1 << row)) == 0) {
+                        continue;
+                    }
+                    const unsigned int first = (offset + ((font_traits::charHeight - 1 - row) * dotScale));
+                    for(unsigned int dot = first; dot < (first + dotScale); ++dot) {
+                        band[dot / 8] |= (0x80 >> (dot % 8));
+                    }
+                }
+            }
+            /* send the band, one row repeated to the scale, blank once cancelled */ {
+                if(send ( command_traits::control
+                        , command_traits::function
+                        , command_traits::n1(dotScale)
+                        , bytes ) == false) {
+                    return;
+                }
+                _inCommand = true;
+                for(unsigned int row = 0; row < dotScale; ++row) {
+                    if(_cancelled != false) {
+                        ::memset(band, 0, sizeof(band));
+                    }
+                    send(band, bytes);
+                }
+                _inCommand = false;
+                advance(dotScale, 0UL);
+            }
+            if(abortIfCancelled()) {
+                return;
+            }
+        }
+        /* inter-character spacing */ {
+            feedRows(dotScale);
         }
     }
+}
+
+int ThermalPrinter::hasPaper()
+{
+    THERMAL_PRINTER_TRACE_SCOPE("hasPaper");
 
     typedef Command::GetPrinterStatus command_traits;
 
+    const Guard guard;
+
+    flushInput();
+#if THERMAL_PRINTER_STATISTICS
+    /* update statistics */ {
+        ++_statistics.statusPolls;
+    }
+#endif
     send ( command_traits::control
          , command_traits::function
          , command_traits::n1(0x00) );
 
     int has_paper = -1;
     /* fetch status */ {
-        int status = -1;
-        constexpr int retry_count = 10;
-        constexpr int retry_delay = 25;
-        for(int retry = 0; retry < retry_count; ++retry) {
-            if(_stream.available()) {
-                status = _stream.read();
-                break;
-            }
-            else {
-                ::delay(retry_delay);
-            }
-        }
+        const int status = receive();
         if(status != -1) {
             if((status & 0b00000100) == 0) {
                 has_paper = 1;
@@ -818,117 +1856,620 @@ int ThermalPrinter::hasPaper()
     return has_paper;
 }
 
+bool ThermalPrinter::detectFirmware()
+{
+    THERMAL_PRINTER_TRACE_SCOPE("detectFirmware");
+
+    typedef Command::GetPrinterId command_traits;
+
+    const Guard guard;
+
+    flushInput();
+#if THERMAL_PRINTER_STATISTICS
+    /* update statistics */ {
+        ++_statistics.statusPolls;
+    }
+#endif
+    send ( command_traits::control
+         , command_traits::function
+         , command_traits::n1(command_traits::version) );
+
+    /* fetch version, a printer that answers implements the GS command set */ {
+        const int reply = receive();
+        if((reply == -1) || (reply == 0x00) || (reply == 0xff)) {
+            return false;
+        }
+        flushInput();
+    }
+    /* raise the firmware version, which replaces the capabilities */ {
+        if(_firmwareVersion < Traits::Printer::firmwareGS) {
+            setFirmwareVersion(Traits::Printer::firmwareGS);
+        }
+    }
+    return true;
+}
+
+void ThermalPrinter::setFirmwareVersion(const uint16_t version)
+{
+    _firmwareVersion = version;
+    _capabilities    = Traits::capabilities(version);
+}
+
+uint16_t ThermalPrinter::getFirmwareVersion() const
+{
+    return _firmwareVersion;
+}
+
+uint8_t ThermalPrinter::getCapabilities() const
+{
+    return _capabilities;
+}
+
+ThermalPrinterStatistics ThermalPrinter::getStatistics() const
+{
+#if THERMAL_PRINTER_STATISTICS
+    return _statistics;
+#else
+    return ThermalPrinterStatistics();
+#endif
+}
+
+void ThermalPrinter::resetStatistics()
+{
+#if THERMAL_PRINTER_STATISTICS
+    _statistics = ThermalPrinterStatistics();
+#endif
+}
+
+void ThermalPrinter::dumpTrace(Print& output)
+{
+#if THERMAL_PRINTER_TRACE
+    const Guard guard;
+
+    const unsigned int first = ((_traceIndex + THERMAL_PRINTER_TRACE_EVENTS - _traceCount) % THERMAL_PRINTER_TRACE_EVENTS);
+    for(unsigned int count = 0; count < _traceCount; ++count) {
+        const ThermalPrinterTraceEvent& event(_traceEvents[(first + count) % THERMAL_PRINTER_TRACE_EVENTS]);
+        output.print(F("trace "));
+        output.print(event.name);
+        output.print(F(" "));
+        output.print(event.enter);
+        output.print(F(" "));
+        output.print(event.leave);
+        output.print(F(" "));
+        output.println(event.bytes);
+    }
+#else
+    (void) output;
+#endif
+}
+
+void ThermalPrinter::resetTrace()
+{
+#if THERMAL_PRINTER_TRACE
+    const Guard guard;
+
+    _traceIndex = 0;
+    _traceCount = 0;
+#endif
+}
+
+void ThermalPrinter::setBaudRate(const unsigned long baudRate)
+{
+    waitReady();
+
+    /* adjust the pacing */ {
+        _baudRate = (baudRate != 0UL ? baudRate : Traits::Printer::serialBaudRate);
+        _byteTime = Traits::byteTime(_baudRate);
+    }
+}
+
+unsigned long ThermalPrinter::getBaudRate() const
+{
+    return _baudRate;
+}
+
+void ThermalPrinter::setPacing(const bool enabled)
+{
+    if((enabled != false) && (_pacing == false)) {
+        _deadline = ::micros();
+    }
+    _pacing = enabled;
+}
+
+void ThermalPrinter::setPrintingSpeed(const unsigned long dotPrintTime, const unsigned long dotFeedTime)
+{
+    _dotPrintTime = dotPrintTime;
+    _dotFeedTime  = dotFeedTime;
+}
+
+void ThermalPrinter::cancel()
+{
+    _cancelled = true;
+}
+
+bool ThermalPrinter::isCancelled() const
+{
+    return _cancelled;
+}
+
+void ThermalPrinter::clearCancel()
+{
+    _cancelled = false;
+    _aborted   = false;
+}
+
 void ThermalPrinter::waitReady()
 {
+    THERMAL_PRINTER_TRACE_SCOPE("waitReady");
+
     (void) waitAndSetNextTimeout(0UL);
 }
 
+bool ThermalPrinter::isReady() const
+{
+    const unsigned long now      = ::micros();
+    const unsigned long deadline = _deadline;
+
+    return static_cast<long>(now - deadline) >= 0L;
+}
+
 bool ThermalPrinter::waitAndSetNextTimeout(const unsigned long timeout)
 {
+    THERMAL_PRINTER_TRACE_SCOPE("waitAndSetNextTimeout");
+
+    if(_pacing == false) {
+        return true;
+    }
+
     unsigned long       now      = ::micros();
     unsigned long const deadline = _deadline;
+#if THERMAL_PRINTER_STATISTICS
+    unsigned long const started  = now;
+#endif
 
     /* waiting for the previous timeout */ {
         while(static_cast<long>(now - deadline) < 0L) {
+            THERMAL_PRINTER_YIELD();
             now = ::micros();
         }
     }
     /* set the next timeout */ {
         _deadline = (now + timeout);
     }
+#if THERMAL_PRINTER_STATISTICS
+    /* update statistics */ {
+        _statistics.waitTime += (now - started);
+    }
+#endif
     return true;
 }
 
-bool ThermalPrinter::send(const uint8_t a)
+bool ThermalPrinter::advance(const unsigned long printedRows, const unsigned long fedRows)
 {
-    constexpr unsigned long bytetime  = Traits::Printer::serialByteTime;
-    constexpr unsigned long bytecount = 1UL;
-    constexpr unsigned long timeout   = (bytetime * bytecount);
-
-    if(waitAndSetNextTimeout(timeout)) {
-        _stream.write(a);
-        _stream.flush();
+    const unsigned long timeout = (printedRows * _dotPrintTime)
+                                + (fedRows     * _dotFeedTime );
+
+    /* extend the pacing deadline by the mechanical time */ {
+        if((timeout != 0UL) && (_pacing != false)) {
+            const unsigned long now = ::micros();
+            if(static_cast<long>(now - _deadline) > 0L) {
+                _deadline = now;
+            }
+            _deadline += timeout;
+        }
+    }
+    /* track the vertical position */ {
+        _position += (printedRows + fedRows);
+    }
+#if THERMAL_PRINTER_STATISTICS
+    /* update statistics */ {
+        _statistics.rowsPrinted += printedRows;
+        _statistics.rowsFed     += fedRows;
     }
+#endif
     return true;
 }
 
-bool ThermalPrinter::send(const uint8_t a, const uint8_t b)
+uint8_t ThermalPrinter::charHeight() const
 {
-    constexpr unsigned long bytetime  = Traits::Printer::serialByteTime;
-    constexpr unsigned long bytecount = 2UL;
-    constexpr unsigned long timeout   = (bytetime * bytecount);
+    typedef Command::SetPrintMode command_traits;
 
-    if(waitAndSetNextTimeout(timeout)) {
-        _stream.write(a);
-        _stream.write(b);
-        _stream.flush();
+    const bool hasFontBit         = ((_printMode & command_traits::bit0) != 0);
+    const bool hasDoubleHeightBit = ((_printMode & command_traits::bit4) != 0);
+
+    return Traits::charHeight(hasFontBit, hasDoubleHeightBit);
+}
+
+uint8_t ThermalPrinter::charWidth() const
+{
+    typedef Command::SetPrintMode command_traits;
+
+    const bool hasFontBit        = ((_printMode & command_traits::bit0) != 0);
+    const bool hasDoubleWidthBit = ((_printMode & command_traits::bit5) != 0);
+
+    return Traits::charWidth(hasFontBit, hasDoubleWidthBit) + _charSpacing;
+}
+
+uint8_t ThermalPrinter::pendingLine()
+{
+    if(_lineWidth == 0) {
+        return 0;
     }
-    return true;
+    /* the print and feed commands print the pending line first */ {
+        _lineWidth = 0;
+    }
+    return charHeight();
 }
 
-bool ThermalPrinter::send(const uint8_t a, const uint8_t b, const uint8_t c)
+unsigned long ThermalPrinter::printedLines(const uint8_t* buffer, const size_t length)
 {
-    constexpr unsigned long bytetime  = Traits::Printer::serialByteTime;
-    constexpr unsigned long bytecount = 3UL;
-    constexpr unsigned long timeout   = (bytetime * bytecount);
+    const unsigned int width = charWidth();
+    unsigned long      lines = 0UL;
+
+    for(size_t index = 0; index < length; ++index) {
+        const uint8_t character = buffer[index];
+        if(character == ASCII::LF) {
+            _lineWidth = 0;
+            ++lines;
+            continue;
+        }
+        if(character < 0x20) {
+            continue;
+        }
+        /* the printer wraps the line before a character that does not fit */ {
+            if((_lineWidth + width) > Traits::Printer::dotsPerLine) {
+                _lineWidth = 0;
+                ++lines;
+            }
+            _lineWidth += width;
+        }
+    }
+    return lines;
+}
 
-    if(waitAndSetNextTimeout(timeout)) {
-        _stream.write(a);
-        _stream.write(b);
-        _stream.write(c);
-        _stream.flush();
+uint8_t ThermalPrinter::lineHeight() const
+{
+    const uint8_t charHeight = ThermalPrinter::charHeight();
+
+    return (_lineSpacing > charHeight ? _lineSpacing : charHeight);
+}
+
+void ThermalPrinter::flushInput()
+{
+    while(_stream.available()) {
+        (void) _stream.read();
+    }
+}
+
+int ThermalPrinter::receive()
+{
+    constexpr int retry_count = 10;
+    constexpr int retry_delay = 25;
+
+    for(int retry = 0; retry < retry_count; ++retry) {
+        if(_stream.available()) {
+            return _stream.read();
+        }
+        else {
+            ::delay(retry_delay);
+        }
+    }
+    return -1;
+}
+
+bool ThermalPrinter::abortIfCancelled()
+{
+    if((_jobDepth == 0) || (_inCommand != false)) {
+        return false;
+    }
+    if(_aborted != false) {
+        return true;
+    }
+    if(_cancelled == false) {
+        return false;
+    }
+    /* resync the printer and the shadow values, then drop the rest of the job */ {
+        _aborted   = true;
+        _inCommand = true;
+        reset();
+        _inCommand = false;
     }
     return true;
 }
 
-bool ThermalPrinter::send(const uint8_t a, const uint8_t b, const uint8_t c, const uint8_t d)
+bool ThermalPrinter::printMarkup(const char* markup, const size_t size, const bool last, size_t& consumed)
 {
-    constexpr unsigned long bytetime  = Traits::Printer::serialByteTime;
-    constexpr unsigned long bytecount = 4UL;
-    constexpr unsigned long timeout   = (bytetime * bytecount);
+    const char* const end    = (markup + size);
+    const char*       text   = markup;
+    const char*       cursor = markup;
+
+    consumed = size;
+    while(cursor < end) {
+        if(*cursor != '{') {
+            ++cursor;
+            continue;
+        }
+        /* print the pending text */ {
+            if(cursor != text) {
+                const size_t length = (cursor - text);
+                if(write(reinterpret_cast<const uint8_t*>(text), length) < length) {
+                    return false;
+                }
+                text = cursor;
+            }
+        }
+        /* a brace ending the chunk may start an escape or a tag */ {
+            if(((cursor + 1) == end) && (last == false) && (cursor != markup)) {
+                consumed = (cursor - markup);
+                return true;
+            }
+        }
+        /* an escaped brace is printed as is */ {
+            if(((cursor + 1) < end) && (cursor[1] == '{')) {
+                text    = (cursor + 1);
+                cursor += 2;
+                continue;
+            }
+        }
+        /* apply the tag, the brace of an unterminated one is printed as is */ {
+            const char*  tag    = (cursor + 1);
+            const size_t rest   = (end - tag);
+            const size_t window = (rest > Markup::maxLength ? (Markup::maxLength + 1) : rest);
+            const char*  close  = static_cast<const char*>(::memchr(tag, '}', window));
+            if(close == nullptr) {
+                if((window <= Markup::maxLength) && (last == false) && (cursor != markup)) {
+                    consumed = (cursor - markup);
+                    return true;
+                }
+                ++cursor;
+                continue;
+            }
+            if(abortIfCancelled()) {
+                return false;
+            }
+            (void) Markup::apply(*this, tag, (close - tag));
+            text   = (close + 1);
+            cursor = (close + 1);
+        }
+    }
+    /* print the remaining text */ {
+        if(end != text) {
+            const size_t length = (end - text);
+            if(write(reinterpret_cast<const uint8_t*>(text), length) < length) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
 
-    if(waitAndSetNextTimeout(timeout)) {
-        _stream.write(a);
-        _stream.write(b);
-        _stream.write(c);
-        _stream.write(d);
-        _stream.flush();
+bool ThermalPrinter::wakeIfSleeping()
+{
+#if THERMAL_PRINTER_AUTOWAKE
+    if(_sleepTimeout != 0UL) {
+        const unsigned long now  = ::millis();
+        const unsigned long idle = (now - _lastActivity);
+
+        _lastActivity = now;
+        if(idle >= _sleepTimeout) {
+            wakePrinter();
+        }
     }
+#endif
     return true;
 }
 
-bool ThermalPrinter::send(const uint8_t a, const uint8_t b, const uint8_t c, const uint8_t d, const uint8_t e)
+bool ThermalPrinter::send(const uint8_t* buffer, const size_t length)
 {
-    constexpr unsigned long bytetime  = Traits::Printer::serialByteTime;
-    constexpr unsigned long bytecount = 5UL;
-    constexpr unsigned long timeout   = (bytetime * bytecount);
+    THERMAL_PRINTER_TRACE_SCOPE("send");
+
+    const     unsigned long bytetime  = _byteTime;
+    const     unsigned long bytecount = length;
+    const     unsigned long timeout   = (bytetime * bytecount);
 
-    if(waitAndSetNextTimeout(timeout)) {
-        _stream.write(a);
-        _stream.write(b);
-        _stream.write(c);
-        _stream.write(d);
-        _stream.write(e);
+    const Guard guard;
+
+    if(abortIfCancelled()) {
+        return false;
+    }
+    if(wakeIfSleeping() && waitAndSetNextTimeout(timeout)) {
+        _stream.write(buffer, length);
         _stream.flush();
     }
+#if THERMAL_PRINTER_STATISTICS
+    /* update statistics */ {
+        _statistics.bytesSent    += length;
+        _statistics.commandsSent += 1;
+    }
+#endif
+#if THERMAL_PRINTER_TRACE
+    /* update the trace byte count */ {
+        _traceBytes += length;
+    }
+#endif
     return true;
 }
 
+bool ThermalPrinter::send(const uint8_t a)
+{
+    const uint8_t buffer[] = { a };
+
+    return send(buffer, sizeof(buffer));
+}
+
+bool ThermalPrinter::send(const uint8_t a, const uint8_t b)
+{
+    const uint8_t buffer[] = { a, b };
+
+    return send(buffer, sizeof(buffer));
+}
+
+bool ThermalPrinter::send(const uint8_t a, const uint8_t b, const uint8_t c)
+{
+    const uint8_t buffer[] = { a, b, c };
+
+    return send(buffer, sizeof(buffer));
+}
+
+bool ThermalPrinter::send(const uint8_t a, const uint8_t b, const uint8_t c, const uint8_t d)
+{
+    const uint8_t buffer[] = { a, b, c, d };
+
+    return send(buffer, sizeof(buffer));
+}
+
+bool ThermalPrinter::send(const uint8_t a, const uint8_t b, const uint8_t c, const uint8_t d, const uint8_t e)
+{
+    const uint8_t buffer[] = { a, b, c, d, e };
+
+    return send(buffer, sizeof(buffer));
+}
+
 size_t ThermalPrinter::write(uint8_t character)
 {
-    constexpr unsigned long bytetime  = Traits::Printer::serialByteTime;
+    THERMAL_PRINTER_TRACE_SCOPE("write");
+
+    const     unsigned long bytetime  = _byteTime;
     constexpr unsigned long bytecount = 1UL;
-    constexpr unsigned long timeout   = (bytetime * bytecount);
+    const     unsigned long timeout   = (bytetime * bytecount);
 
     if(character == ASCII::CR) {
         return 1;
     }
-    if(waitAndSetNextTimeout(timeout)) {
+
+    const Guard guard;
+    const Job   job(*this);
+
+    if(abortIfCancelled()) {
+        return 0;
+    }
+    if(wakeIfSleeping() && waitAndSetNextTimeout(timeout)) {
         _stream.write(character);
     }
+#if THERMAL_PRINTER_STATISTICS
+    /* update statistics */ {
+        _statistics.bytesSent += 1;
+    }
+#endif
+#if THERMAL_PRINTER_TRACE
+    /* update the trace byte count */ {
+        _traceBytes += 1;
+    }
+#endif
+    /* account for the completed lines */ {
+        const unsigned long lines = printedLines(&character, 1);
+        if(lines != 0UL) {
+            advance((lines * charHeight()), (lines * (lineHeight() - charHeight())));
+        }
+    }
     return 1;
 }
 
+size_t ThermalPrinter::write(const uint8_t* buffer, size_t size)
+{
+    THERMAL_PRINTER_TRACE_SCOPE("write");
+
+    const Guard guard;
+    const Job   job(*this);
+
+    const uint8_t* const begin = buffer;
+    const uint8_t* const end   = (buffer + size);
+    while(buffer < end) {
+        if(abortIfCancelled()) {
+            return (buffer - begin);
+        }
+        const uint8_t* run = buffer;
+        /* gather the characters up to the next line feed, stop at carriage returns */ {
+            while((run < end) && (*run != ASCII::CR)) {
+                if(*run++ == ASCII::LF) {
+                    break;
+                }
+            }
+        }
+        const size_t length = (run - buffer);
+        if(length != 0) {
+            const unsigned long bytetime  = _byteTime;
+            const unsigned long bytecount = length;
+            const unsigned long timeout   = (bytetime * bytecount);
+
+            if(wakeIfSleeping() && waitAndSetNextTimeout(timeout)) {
+                _stream.write(buffer, length);
+            }
+#if THERMAL_PRINTER_STATISTICS
+            /* update statistics */ {
+                _statistics.bytesSent += length;
+            }
+#endif
+#if THERMAL_PRINTER_TRACE
+            /* update the trace byte count */ {
+                _traceBytes += length;
+            }
+#endif
+            /* account for the completed lines, wrapped ones included */ {
+                const unsigned long lines = printedLines(buffer, length);
+                if(lines != 0UL) {
+                    advance((lines * charHeight()), (lines * (lineHeight() - charHeight())));
+                }
+            }
+        }
+        /* skip the carriage returns */ {
+            while((run < end) && (*run == ASCII::CR)) {
+                ++run;
+            }
+        }
+        buffer = run;
+    }
+    return size;
+}
+
+size_t ThermalPrinter::print(const __FlashStringHelper* string)
+{
+    THERMAL_PRINTER_TRACE_SCOPE("print");
+
+    const Guard guard;
+    const Job   job(*this);
+
+    PGM_P  pointer = reinterpret_cast<PGM_P>(string);
+    size_t count   = 0;
+
+    for(;;) {
+        uint8_t buffer[16];
+        size_t  length = 0;
+        /* copy a chunk of the flash string */ {
+            while(length < sizeof(buffer)) {
+                const uint8_t character = pgm_read_byte(pointer++);
+                if(character == ASCII::NUL) {
+                    break;
+                }
+                buffer[length++] = character;
+            }
+        }
+        if(length != 0) {
+            const size_t written = write(buffer, length);
+            count += written;
+            if(written < length) {
+                break;
+            }
+        }
+        if(length < sizeof(buffer)) {
+            break;
+        }
+    }
+    return count;
+}
+
+size_t ThermalPrinter::println(const __FlashStringHelper* string)
+{
+    THERMAL_PRINTER_TRACE_SCOPE("println");
+
+    const Guard guard;
+    const Job   job(*this);
+
+    const size_t count = print(string);
+
+    return count + println();
+}
+
 // ---------------------------------------------------------------------------
 // End-Of-File
 // ---------------------------------------------------------------------------
@@ -23,6 +23,8 @@
 // ThermalPrinter defines
 // ---------------------------------------------------------------------------
 
+// a mixed fleet must be built with a firmware below 216, detectFirmware() only raises it
+
 #ifndef THERMAL_PRINTER_FIRMWARE
 #define THERMAL_PRINTER_FIRMWARE 216
 #endif
@@ -35,6 +37,44 @@
 #define THERMAL_PRINTER_BYTETIME (((8UL + 2UL) * 1000000UL) / (THERMAL_PRINTER_BAUDRATE))
 #endif
 
+#ifndef THERMAL_PRINTER_STATISTICS
+#define THERMAL_PRINTER_STATISTICS 1
+#endif
+
+#ifndef THERMAL_PRINTER_AUTOWAKE
+#define THERMAL_PRINTER_AUTOWAKE 1
+#endif
+
+#ifndef THERMAL_PRINTER_YIELD
+#define THERMAL_PRINTER_YIELD() ::yield()
+#endif
+
+#ifndef THERMAL_PRINTER_DOTPRINTTIME
+#define THERMAL_PRINTER_DOTPRINTTIME 0UL
+#endif
+
+#ifndef THERMAL_PRINTER_DOTFEEDTIME
+#define THERMAL_PRINTER_DOTFEEDTIME 0UL
+#endif
+
+#ifndef THERMAL_PRINTER_TRACE
+#define THERMAL_PRINTER_TRACE 0
+#endif
+
+#ifndef THERMAL_PRINTER_TRACE_EVENTS
+#define THERMAL_PRINTER_TRACE_EVENTS 32
+#endif
+
+// the lock must be recursive (status queries nest a send inside their lock)
+
+#ifndef THERMAL_PRINTER_LOCK
+#define THERMAL_PRINTER_LOCK() do {} while(0)
+#endif
+
+#ifndef THERMAL_PRINTER_UNLOCK
+#define THERMAL_PRINTER_UNLOCK() do {} while(0)
+#endif
+
 // ---------------------------------------------------------------------------
 // ThermalPrinter Character Set
 // ---------------------------------------------------------------------------
@@ -146,6 +186,42 @@ struct ThermalPrinterBarcodeSystem
     static constexpr uint8_t BS_WIDTH_HUGE   = 6;
 };
 
+// ---------------------------------------------------------------------------
+// ThermalPrinter Capabilities
+// ---------------------------------------------------------------------------
+
+struct ThermalPrinterCapabilities
+{
+    static constexpr uint8_t CAP_REVERSE_MODE     = (1 << 0);
+    static constexpr uint8_t CAP_UPSIDE_DOWN_MODE = (1 << 1);
+};
+
+// ---------------------------------------------------------------------------
+// ThermalPrinter Statistics
+// ---------------------------------------------------------------------------
+
+struct ThermalPrinterStatistics
+{
+    unsigned long bytesSent    = 0; // bytes written to the stream
+    unsigned long commandsSent = 0; // commands written to the stream
+    unsigned long rowsFed      = 0; // dot rows fed by feed commands
+    unsigned long rowsPrinted  = 0; // dot rows printed by text lines
+    unsigned long waitTime     = 0; // microseconds spent waiting for the pacing
+    unsigned long statusPolls  = 0; // status requests
+};
+
+// ---------------------------------------------------------------------------
+// ThermalPrinter Trace Event
+// ---------------------------------------------------------------------------
+
+struct ThermalPrinterTraceEvent
+{
+    const __FlashStringHelper* name = nullptr; // traced method
+    unsigned long enter = 0; // micros() on entry
+    unsigned long leave = 0; // micros() on exit
+    unsigned long bytes = 0; // bytes sent while inside the method
+};
+
 // ---------------------------------------------------------------------------
 // ThermalPrinter
 // ---------------------------------------------------------------------------
@@ -158,7 +234,7 @@ public: // public interface
 
     virtual ~ThermalPrinter() = default;
 
-    void begin();
+    void begin(const bool detect = false);
     void reset();
     void end();
 
@@ -172,6 +248,14 @@ public: // public interface
 
     void feedRows              ( const uint8_t rows );
 
+    void feedDots              ( const uint16_t dots );
+
+    void feedToLength          ( const uint16_t length );
+
+    unsigned long getPosition  ( ) const;
+
+    void resetPosition         ( );
+
     void setJustification      ( const uint8_t justification );
 
     void setCharacterSet       ( const uint8_t number );
@@ -186,6 +270,10 @@ public: // public interface
                                , const uint8_t time
                                , const uint8_t interval );
 
+    void getPrintingParameters ( uint8_t& dots
+                               , uint8_t& time
+                               , uint8_t& interval ) const;
+
     void setPrintingDensity    ( const uint8_t density
                                , const uint8_t breaktime );
 
@@ -217,17 +305,105 @@ public: // public interface
 
     void setBarcodeHeight      ( const uint8_t height );
 
-    void printBarcode          ( const char *text, const uint8_t type );
+    bool printBarcode          ( const char *text, const uint8_t type );
+
+    bool printBarcode          ( const __FlashStringHelper *text, const uint8_t type );
+
+    uint8_t fitBarcodeWidth    ( const char *text, const uint8_t type );
+
+    void printMarkup           ( const char *markup );
+
+    void printMarkup           ( const __FlashStringHelper *markup );
+
+    void printBanner           ( const char *text, const uint8_t scale );
 
     int  hasPaper              ( );
 
+    bool detectFirmware        ( );
+
+    void setFirmwareVersion    ( const uint16_t version );
+
+    uint16_t getFirmwareVersion ( ) const;
+
+    uint8_t getCapabilities    ( ) const;
+
+    void setBaudRate           ( const unsigned long baudRate );
+
+    unsigned long getBaudRate  ( ) const;
+
+    void setPacing             ( const bool enabled );
+
+    void setPrintingSpeed      ( const unsigned long dotPrintTime
+                               , const unsigned long dotFeedTime );
+
+    ThermalPrinterStatistics getStatistics ( ) const;
+
+    void resetStatistics       ( );
+
+    void dumpTrace             ( Print& output );
+
+    void resetTrace            ( );
+
+    void cancel                ( );
+
+    bool isCancelled           ( ) const;
+
+    void clearCancel           ( );
+
     void waitReady             ( );
 
+    bool isReady               ( ) const;
+
+    size_t print(const __FlashStringHelper* string);
+
+    size_t println(const __FlashStringHelper* string);
+
     virtual size_t write(uint8_t character) override;
 
+    virtual size_t write(const uint8_t* buffer, size_t size) override;
+
+    using Print::print;
+    using Print::println;
+    using Print::write;
+
 protected: // protected interface
+    class Job;
+#if THERMAL_PRINTER_TRACE
+    class Trace;
+#endif
+
     bool waitAndSetNextTimeout(const unsigned long timeout);
 
+    void flushInput();
+
+    int  receive();
+
+    bool abortIfCancelled();
+
+    bool printMarkup ( const char*  markup
+                     , const size_t size
+                     , const bool   last
+                     , size_t&      consumed );
+
+    bool wakeIfSleeping();
+
+    bool advance ( const unsigned long printedRows
+                 , const unsigned long fedRows );
+
+    uint8_t charHeight() const;
+
+    uint8_t charWidth() const;
+
+    unsigned long printedLines ( const uint8_t* buffer
+                               , const size_t   length );
+
+    uint8_t pendingLine();
+
+    uint8_t lineHeight() const;
+
+    bool send ( const uint8_t* buffer
+              , const size_t   length );
+
     bool send ( const uint8_t a );
 
     bool send ( const uint8_t a
@@ -251,7 +427,41 @@ protected: // protected interface
 private: // private data
     Stream&       _stream;
     unsigned long _deadline;
+    unsigned long _baudRate;
+    unsigned long _byteTime;
+    unsigned long _dotPrintTime;
+    unsigned long _dotFeedTime;
+    unsigned long _position;
+#if THERMAL_PRINTER_AUTOWAKE
+    unsigned long _sleepTimeout;
+    unsigned long _lastActivity;
+#endif
+    bool          _pacing;
+    volatile bool _cancelled;
+    bool          _aborted;
+    bool          _inCommand;
+    uint8_t       _jobDepth;
     uint8_t       _printMode;
+    uint8_t       _charSpacing;
+    uint8_t       _barcodeLabel;
+    uint8_t       _heatingDots;
+    uint8_t       _heatingTime;
+    uint8_t       _heatingInterval;
+    uint8_t       _barcodeWidth;
+    uint8_t       _barcodeHeight;
+    uint8_t       _lineSpacing;
+    uint16_t      _lineWidth;
+    uint16_t      _firmwareVersion;
+    uint8_t       _capabilities;
+#if THERMAL_PRINTER_STATISTICS
+    ThermalPrinterStatistics _statistics;
+#endif
+#if THERMAL_PRINTER_TRACE
+    ThermalPrinterTraceEvent _traceEvents[THERMAL_PRINTER_TRACE_EVENTS];
+    unsigned int             _traceIndex;
+    unsigned int             _traceCount;
+    unsigned long            _traceBytes;
+#endif
 };
 
 // ---------------------------------------------------------------------------
@@ -243,7 +243,7 @@ void MainLoop::begin()
     }
     /* barcode 'UPC-A' */ {
         const ThermalPrinterBarcodeSystem BarcodeSystem;
-        const char*       bc_data     = "123456789123";
+        const char*       bc_data     = "12345678912";
         constexpr uint8_t bc_type     = BarcodeSystem.BS_UPC_A;
         constexpr uint8_t bc_position = BarcodeSystem.BS_TEXT_BELOW;
         constexpr uint8_t bc_width    = BarcodeSystem.BS_WIDTH_SMALL;
@@ -288,6 +288,7 @@ void MainLoop::wait() const
     unsigned long const deadline = _deadline;
 
     while(static_cast<long>(now - deadline) < 0L) {
+        ::yield();
         now = ::micros();
     }
 }
@@ -0,0 +1,141 @@
+/*
+ * Arduino.h - Copyright (c) 2014-2025 - Olivier Poncet
+ *
+ * This file is part of the CSN-A2 library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Minimal host-side stand-in for the Arduino core, just enough to build
+ * ThermalPrinter.cpp on the host. Flash strings live in RAM.
+ */
+#ifndef __INO_CSN_A2_Arduino_h__
+#define __INO_CSN_A2_Arduino_h__
+
+#include <cstdio>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// ---------------------------------------------------------------------------
+// flash strings
+// ---------------------------------------------------------------------------
+
+class __FlashStringHelper;
+
+#define PROGMEM
+#define PGM_P              const char*
+#define F(string)          (reinterpret_cast<const __FlashStringHelper*>(string))
+#define pgm_read_byte(ptr) (*reinterpret_cast<const uint8_t*>(ptr))
+
+// ---------------------------------------------------------------------------
+// time
+// ---------------------------------------------------------------------------
+
+unsigned long micros();
+
+unsigned long millis();
+
+void delay(unsigned long milliseconds);
+
+void yield();
+
+// ---------------------------------------------------------------------------
+// Print
+// ---------------------------------------------------------------------------
+
+class Print
+{
+public: // public interface
+    virtual ~Print() = default;
+
+    virtual size_t write(uint8_t character) = 0;
+
+    virtual size_t write(const uint8_t* buffer, size_t size)
+    {
+        size_t count = 0;
+        while(size-- != 0) {
+            count += write(*buffer++);
+        }
+        return count;
+    }
+
+    size_t write(const char* string)
+    {
+        return write(reinterpret_cast<const uint8_t*>(string), ::strlen(string));
+    }
+
+    size_t print(const char* string)
+    {
+        return write(string);
+    }
+
+    size_t print(const __FlashStringHelper* string)
+    {
+        return write(reinterpret_cast<const char*>(string));
+    }
+
+    size_t print(unsigned long value)
+    {
+        char buffer[24];
+        (void) ::snprintf(buffer, sizeof(buffer), "%lu", value);
+        return write(buffer);
+    }
+
+    size_t println()
+    {
+        return write("\r\n");
+    }
+
+    size_t println(const char* string)
+    {
+        return print(string) + println();
+    }
+
+    size_t println(const __FlashStringHelper* string)
+    {
+        return print(string) + println();
+    }
+
+    size_t println(unsigned long value)
+    {
+        return print(value) + println();
+    }
+
+    virtual void flush()
+    {
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Stream
+// ---------------------------------------------------------------------------
+
+class Stream
+    : public Print
+{
+public: // public interface
+    virtual int available() = 0;
+
+    virtual int read() = 0;
+
+    virtual int peek() = 0;
+};
+
+// ---------------------------------------------------------------------------
+// End-Of-File
+// ---------------------------------------------------------------------------
+
+#endif /* __INO_CSN_A2_Arduino_h__ */
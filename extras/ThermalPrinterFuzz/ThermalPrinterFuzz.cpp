@@ -0,0 +1,633 @@
+/*
+ * ThermalPrinterFuzz.cpp - Copyright (c) 2014-2025 - Olivier Poncet
+ *
+ * This file is part of the CSN-A2 library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Host-side fuzzer of the command encoders of ThermalPrinter.
+ *
+ * build : c++ -std=c++11 -O2 -I. -I../.. -o ThermalPrinterFuzz ThermalPrinterFuzz.cpp ../../ThermalPrinter.cpp
+ * usage : ThermalPrinterFuzz [-s seed] [-n runs]
+ *
+ * libFuzzer build :
+ *
+ *   clang++ -std=c++11 -g -O1 -fsanitize=fuzzer,address -DTHERMAL_PRINTER_LIBFUZZER \
+ *           -I. -I../.. -o ThermalPrinterFuzz ThermalPrinterFuzz.cpp ../../ThermalPrinter.cpp
+ *
+ * Each input is decoded as a sequence of calls (setters, print, printBarcode,
+ * feedDots, ...) made on a ThermalPrinter with the pacing disabled. The bytes
+ * emitted by each call are parsed with the ThermalPrinterRender parser and
+ * checked against the expected commands: every call emits whole commands,
+ * every parameter follows the clamp table documented in the README, the
+ * GS k length byte matches the bytes that follow, the banner bitmap rows
+ * fit the paper, the markup prints the text outside its tags as is, and so
+ * on. A failed check prints the offending call and aborts.
+ *
+ * Without libFuzzer, the inputs are drawn from a seeded pseudo-random
+ * generator, so that a given seed always replays the same runs.
+ */
+#include <Arduino.h>
+#include <ThermalPrinter.h>
+#include <cstdlib>
+#include <vector>
+#include "../ThermalPrinterRender/ThermalPrinterRender.h"
+
+// ---------------------------------------------------------------------------
+// Arduino
+// ---------------------------------------------------------------------------
+
+namespace {
+
+unsigned long microseconds = 0;
+
+}
+
+unsigned long micros()
+{
+    return microseconds += 10;
+}
+
+unsigned long millis()
+{
+    return micros() / 1000UL;
+}
+
+void delay(unsigned long milliseconds)
+{
+    microseconds += (milliseconds * 1000UL);
+}
+
+void yield()
+{
+}
+
+// ---------------------------------------------------------------------------
+// Capture
+// ---------------------------------------------------------------------------
+
+namespace {
+
+class Capture
+    : public Stream
+{
+public: // public interface
+    virtual size_t write(uint8_t character) override
+    {
+        _bytes.push_back(character);
+        return 1;
+    }
+
+    virtual size_t write(const uint8_t* buffer, size_t size) override
+    {
+        _bytes.insert(_bytes.end(), buffer, buffer + size);
+        return size;
+    }
+
+    virtual int available() override
+    {
+        return 0;
+    }
+
+    virtual int read() override
+    {
+        return -1;
+    }
+
+    virtual int peek() override
+    {
+        return -1;
+    }
+
+    std::vector<uint8_t>& bytes()
+    {
+        return _bytes;
+    }
+
+    using Print::write;
+
+private: // private data
+    std::vector<uint8_t> _bytes;
+};
+
+}
+
+// ---------------------------------------------------------------------------
+// Checker
+// ---------------------------------------------------------------------------
+
+namespace {
+
+class Checker
+    : public Renderer
+{
+public: // public interface
+    Checker(Bitmap& bitmap)
+        : Renderer(bitmap)
+        , _commands()
+    {
+    }
+
+    std::vector<std::vector<uint8_t>>& commands()
+    {
+        return _commands;
+    }
+
+protected: // protected interface
+    virtual void command(const uint8_t* data, const size_t length) override
+    {
+        _commands.emplace_back(data, data + length);
+    }
+
+private: // private data
+    std::vector<std::vector<uint8_t>> _commands;
+};
+
+}
+
+// ---------------------------------------------------------------------------
+// Clamp (the reference table, written independently of the library)
+// ---------------------------------------------------------------------------
+
+namespace {
+
+struct Clamp
+{
+    static uint8_t justification(const uint8_t value)
+    {
+        switch(value) {
+            case 0: case 1: case 2: case '0': case '1': case '2':
+                return value;
+            case 'C':
+                return 1;
+            case 'R':
+                return 2;
+            default:
+                return 0;
+        }
+    }
+
+    static uint8_t characterSet(const uint8_t value)
+    {
+        return (value <= 15 ? value : 0);
+    }
+
+    static uint8_t characterPage(const uint8_t value)
+    {
+        return (value <= 47 ? value : 0);
+    }
+
+    static uint8_t density(const uint8_t density, const uint8_t breaktime)
+    {
+        return ((breaktime < 7 ? breaktime : 7) << 5) | (density < 15 ? density : 15);
+    }
+
+    static uint8_t underline(const uint8_t value)
+    {
+        return (value < 2 ? value : 2);
+    }
+
+    static uint8_t barcodeLabel(const uint8_t value)
+    {
+        return ((value <= 3) || ((value >= '0') && (value <= '3')) ? value : 0);
+    }
+
+    static uint8_t barcodeWidth(const uint8_t value)
+    {
+        return ((value >= 2) && (value <= 6) ? value : 3);
+    }
+
+    static uint8_t barcodeHeight(const uint8_t value)
+    {
+        return ((value >= 1) && (value <= 254) ? value : 162);
+    }
+};
+
+}
+
+// ---------------------------------------------------------------------------
+// Fuzzer
+// ---------------------------------------------------------------------------
+
+namespace {
+
+class Fuzzer
+{
+public: // public interface
+    Fuzzer(const uint8_t* data, const size_t size)
+        : _data(data)
+        , _size(size)
+        , _index(0)
+        , _capture()
+        , _printer(_capture)
+        , _bitmap()
+        , _checker(_bitmap)
+        , _call("")
+    {
+    }
+
+    void run();
+
+protected: // protected interface
+    uint8_t next()
+    {
+        return (_index < _size ? _data[_index++] : 0);
+    }
+
+    void text(char* buffer, const size_t capacity, const char* alphabet);
+
+    void call(const char* name);
+
+    void check(const bool condition, const char* what);
+
+    void expect(const uint8_t control, const uint8_t function, const uint8_t value);
+
+    void expectMode(const uint8_t bit, const uint8_t control, const uint8_t function, const uint8_t value);
+
+    void expectNothing();
+
+    static void markupText(const char* markup, std::vector<uint8_t>& text);
+
+private: // private data
+    const uint8_t* const   _data;
+    const size_t           _size;
+    size_t                 _index;
+    Capture                _capture;
+    ThermalPrinter         _printer;
+    Bitmap                 _bitmap;
+    Checker                _checker;
+    const char*            _call;
+};
+
+void Fuzzer::run()
+{
+    _printer.setPacing(false);
+    _printer.begin();
+    call("begin");
+    expect(0x1b, '@', 0);
+
+    while(_index < _size) {
+        const uint8_t op = next();
+        const uint8_t v1 = next();
+        const uint8_t v2 = next();
+        switch(op % 21) {
+            case 0:
+                _printer.setJustification(v1);
+                call("setJustification");
+                expect(0x1b, 'a', Clamp::justification(v1));
+                break;
+            case 1:
+                _printer.setCharacterSet(v1);
+                call("setCharacterSet");
+                expect(0x1b, 'R', Clamp::characterSet(v1));
+                break;
+            case 2:
+                _printer.setCharacterPage(v1);
+                call("setCharacterPage");
+                expect(0x1b, 't', Clamp::characterPage(v1));
+                break;
+            case 3:
+                _printer.setCharacterSpacing(v1);
+                call("setCharacterSpacing");
+                expect(0x1b, ' ', v1);
+                break;
+            case 4:
+                _printer.setLineSpacing(v1);
+                call("setLineSpacing");
+                expect(0x1b, '3', v1);
+                break;
+            case 5:
+                _printer.setPrintingDensity(v1, v2);
+                call("setPrintingDensity");
+                expect(0x12, '#', Clamp::density(v1, v2));
+                break;
+            case 6:
+                _printer.setUnderlineMode(v1);
+                call("setUnderlineMode");
+                expect(0x1b, '-', Clamp::underline(v1));
+                break;
+            case 7:
+                _printer.setBarcodeLabel(v1);
+                call("setBarcodeLabel");
+                expect(0x1d, 'H', Clamp::barcodeLabel(v1));
+                break;
+            case 8:
+                _printer.setBarcodeWidth(v1);
+                call("setBarcodeWidth");
+                expect(0x1d, 'w', Clamp::barcodeWidth(v1));
+                break;
+            case 9:
+                _printer.setBarcodeHeight(v1);
+                call("setBarcodeHeight");
+                expect(0x1d, 'h', Clamp::barcodeHeight(v1));
+                break;
+            case 10:
+                _printer.setPrintMode(v1);
+                call("setPrintMode");
+                expect(0x1b, '!', v1);
+                break;
+            case 11:
+                _printer.setPrintingParameters(v1, v2, next());
+                call("setPrintingParameters");
+                check(_checker.commands().size() == 1, "one command");
+                check(_checker.commands()[0].size() == 5, "three parameters");
+                break;
+            case 12: /* print */ {
+                char buffer[32];
+                text(buffer, (v1 % sizeof(buffer)), " !#09AZaz\r\n{}~");
+                const size_t count = _printer.print(buffer);
+                call("print");
+                std::vector<uint8_t> expected;
+                for(const char* character = buffer; *character != '\0'; ++character) {
+                    if(*character != '\r') {
+                        expected.push_back(*character);
+                    }
+                }
+                check(count == ::strlen(buffer), "print count");
+                check(_checker.commands().size() == expected.size(), "one command per character");
+                for(size_t index = 0; index < expected.size(); ++index) {
+                    check(_checker.commands()[index].size() == 1, "plain characters");
+                    check(_checker.commands()[index][0] == expected[index], "characters passed through");
+                }
+                break;
+            }
+            case 13: /* printBarcode */ {
+                char buffer[64];
+                text(buffer, (v1 % sizeof(buffer)), "0123456789ABCZ-$. {}az");
+                const uint8_t type   = (65 + (v2 % 10));
+                const bool    result = _printer.printBarcode(buffer, type);
+                call("printBarcode");
+                if(result == false) {
+                    expectNothing();
+                    break;
+                }
+                check(_checker.commands().size() == 1, "one command");
+                const std::vector<uint8_t>& command(_checker.commands()[0]);
+                check((command[0] == 0x1d) && (command[1] == 'k'), "GS k");
+                check(command[2] == type, "barcode type");
+                check(static_cast<size_t>(command[3]) == (command.size() - 4), "GS k length byte matches the bytes that follow");
+                check(command[3] <= 48, "barcode fits the buffer");
+                break;
+            }
+            case 14: /* feedDots */ {
+                const uint16_t dots = ((v1 << 8) | v2);
+                _printer.feedDots(dots);
+                call("feedDots");
+                const size_t  count = ((dots + 254) / 255);
+                unsigned long total = 0;
+                check(_checker.commands().size() == count, "minimal number of feeds");
+                for(size_t index = 0; index < _checker.commands().size(); ++index) {
+                    const std::vector<uint8_t>& command(_checker.commands()[index]);
+                    check((command[0] == 0x1b) && (command[1] == 'J'), "ESC J");
+                    check((command[2] == 255) || (index == (count - 1)), "maximal feeds");
+                    check(command[2] != 0, "no empty feed");
+                    total += command[2];
+                }
+                check(total == dots, "total feed");
+                break;
+            }
+            case 15:
+                _printer.setOnline(v1);
+                call("setOnline");
+                expect(0x1b, '=', (v1 != 0));
+                break;
+            case 16:
+                _printer.setReverseMode(v1);
+                call("setReverseMode");
+                expectMode(0x02, 0x1d, 'B', (v1 != 0));
+                break;
+            case 17:
+                _printer.setUpsideDownMode(v1);
+                call("setUpsideDownMode");
+                expectMode(0x04, 0x1b, '{', (v1 != 0));
+                break;
+            case 18:
+                _printer.setDoubleStrikeMode(v1);
+                call("setDoubleStrikeMode");
+                expect(0x1b, 'G', (v1 != 0));
+                break;
+            case 19: /* printBanner */ {
+                char buffer[4];
+                text(buffer, (v1 % sizeof(buffer)), " !09AZaz~\x7f");
+                _printer.printBanner(buffer, v2);
+                call("printBanner");
+                size_t bands = 0;
+                size_t feeds = 0;
+                for(const std::vector<uint8_t>& command : _checker.commands()) {
+                    if((command[0] == 0x1b) && (command[1] == 'J')) {
+                        ++feeds;
+                        continue;
+                    }
+                    check((command[0] == 0x12) && (command[1] == '*'), "DC2 * or ESC J");
+                    check((command[2] != 0) && (command[3] != 0), "no empty bitmap");
+                    check(command[3] <= 48, "bitmap rows of at most 48 bytes");
+                    ++bands;
+                }
+                check(bands == (5 * ::strlen(buffer)), "one band per glyph column");
+                check(feeds == ::strlen(buffer), "one spacing per glyph");
+                break;
+            }
+            default: /* printMarkup */ {
+                char buffer[32];
+                text(buffer, (v1 % sizeof(buffer)), "{}/bcdhilrswx ");
+                _printer.printMarkup(buffer);
+                call("printMarkup");
+                std::vector<uint8_t> expected;
+                markupText(buffer, expected);
+                size_t index = 0;
+                for(const std::vector<uint8_t>& command : _checker.commands()) {
+                    if(command.size() == 1) {
+                        check((index < expected.size()) && (command[0] == expected[index++]), "text outside the tags");
+                        continue;
+                    }
+                    switch((command[0] << 8) | command[1]) {
+                        case (0x1b << 8) | '!':
+                            break;
+                        case (0x1d << 8) | 'B':
+                        case (0x1b << 8) | 'G':
+                            check(command[2] <= 1, "mode parameter");
+                            break;
+                        case (0x1b << 8) | '-':
+                        case (0x1b << 8) | 'a':
+                            check(command[2] <= 2, "underline or justification parameter");
+                            break;
+                        default:
+                            check(false, "markup command");
+                            break;
+                    }
+                }
+                check(index == expected.size(), "whole text outside the tags");
+                break;
+            }
+        }
+    }
+    _checker.finish();
+}
+
+void Fuzzer::text(char* buffer, const size_t capacity, const char* alphabet)
+{
+    const size_t count  = ::strlen(alphabet);
+    size_t       length = 0;
+
+    while((length + 1) < capacity) {
+        buffer[length++] = alphabet[next() % count];
+    }
+    buffer[length] = '\0';
+}
+
+void Fuzzer::call(const char* name)
+{
+    _call = name;
+    _checker.commands().clear();
+    check(_checker.parse(_capture.bytes().data(), _capture.bytes().size()), "whole commands");
+    _capture.bytes().clear();
+}
+
+void Fuzzer::check(const bool condition, const char* what)
+{
+    if(condition == false) {
+        ::fprintf(stderr, "error: %s() fails the check '%s', emitted:", _call, what);
+        for(const std::vector<uint8_t>& command : _checker.commands()) {
+            ::fprintf(stderr, " [");
+            for(const uint8_t byte : command) {
+                ::fprintf(stderr, " %02x", byte);
+            }
+            ::fprintf(stderr, " ]");
+        }
+        ::fprintf(stderr, "\n");
+        ::abort();
+    }
+}
+
+void Fuzzer::expect(const uint8_t control, const uint8_t function, const uint8_t value)
+{
+    check(_checker.commands().size() == 1, "one command");
+    const std::vector<uint8_t>& command(_checker.commands()[0]);
+    check((command[0] == control) && (command[1] == function), "command code");
+    check((command.size() == 2) || (command[2] == value), "clamped parameter");
+}
+
+void Fuzzer::expectMode(const uint8_t bit, const uint8_t control, const uint8_t function, const uint8_t value)
+{
+    check((_checker.commands().size() == 1) || (_checker.commands().size() == 2), "print mode and its own command");
+    const std::vector<uint8_t>& mode(_checker.commands()[0]);
+    check((mode[0] == 0x1b) && (mode[1] == '!'), "print mode first");
+    check(((mode[2] & bit) != 0) == (value != 0), "print mode bit");
+    if(_checker.commands().size() == 2) {
+        const std::vector<uint8_t>& command(_checker.commands()[1]);
+        check((command[0] == control) && (command[1] == function), "command code");
+        check(command[2] == value, "clamped parameter");
+    }
+}
+
+void Fuzzer::expectNothing()
+{
+    check(_checker.commands().empty(), "nothing sent");
+}
+
+void Fuzzer::markupText(const char* markup, std::vector<uint8_t>& text)
+{
+    constexpr size_t maxLength = 8; // longest tag between the braces, as in the library
+
+    const char* const end = (markup + ::strlen(markup));
+
+    for(const char* cursor = markup; cursor < end; ++cursor) {
+        if(*cursor != '{') {
+            text.push_back(*cursor);
+            continue;
+        }
+        if(((cursor + 1) < end) && (cursor[1] == '{')) {
+            text.push_back('{');
+            ++cursor;
+            continue;
+        }
+        const size_t rest   = (end - (cursor + 1));
+        const size_t window = (rest > maxLength ? (maxLength + 1) : rest);
+        const char*  close  = static_cast<const char*>(::memchr((cursor + 1), '}', window));
+        if(close == nullptr) {
+            text.push_back('{');
+            continue;
+        }
+        cursor = close;
+    }
+}
+
+}
+
+// ---------------------------------------------------------------------------
+// libFuzzer entry point
+// ---------------------------------------------------------------------------
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+    Fuzzer fuzzer(data, size);
+
+    fuzzer.run();
+
+    return 0;
+}
+
+// ---------------------------------------------------------------------------
+// main
+// ---------------------------------------------------------------------------
+
+#ifndef THERMAL_PRINTER_LIBFUZZER
+
+int main(int argc, char* argv[])
+{
+    unsigned long seed = 1;
+    unsigned long runs = 10000;
+
+    for(int argi = 1; argi < argc; ++argi) {
+        const char* option = argv[argi];
+        if((::strcmp(option, "-s") == 0) && (argi + 1 < argc)) {
+            seed = ::strtoul(argv[++argi], nullptr, 10);
+        }
+        else if((::strcmp(option, "-n") == 0) && (argi + 1 < argc)) {
+            runs = ::strtoul(argv[++argi], nullptr, 10);
+        }
+        else {
+            ::fprintf(stderr, "usage: %s [-s seed] [-n runs]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    uint32_t state = static_cast<uint32_t>(seed != 0 ? seed : 1);
+    auto random = [&]() -> uint32_t
+    {
+        state ^= (state << 13);
+        state ^= (state >> 17);
+        state ^= (state <<  5);
+        return state;
+    };
+
+    std::vector<uint8_t> input;
+    for(unsigned long run = 0; run < runs; ++run) {
+        input.resize(random() % 1024);
+        for(uint8_t& byte : input) {
+            byte = static_cast<uint8_t>(random());
+        }
+        (void) LLVMFuzzerTestOneInput(input.data(), input.size());
+    }
+    ::fprintf(stdout, "%lu runs passed (seed %lu)\n", runs, seed);
+    return EXIT_SUCCESS;
+}
+
+#endif
+
+// ---------------------------------------------------------------------------
+// End-Of-File
+// ---------------------------------------------------------------------------
@@ -0,0 +1,89 @@
+/*
+ * ThermalPrinterRender.cpp - Copyright (c) 2014-2025 - Olivier Poncet
+ *
+ * This file is part of the CSN-A2 library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Host-side renderer of the byte stream produced by ThermalPrinter.
+ *
+ * build : c++ -std=c++11 -O2 -o ThermalPrinterRender ThermalPrinterRender.cpp
+ * usage : ThermalPrinterRender [input.bin [output.pbm]]
+ *
+ * The stream is parsed as the CSN-A2 ESC/POS subset used by the library
+ * and rendered into a 384-dot wide PBM bitmap. Characters use a built-in
+ * 5x7 font scaled into the FontA/FontB cells, barcodes are rendered as a
+ * deterministic stripe pattern of the right size (not a decodable symbol).
+ */
+#include "ThermalPrinterRender.h"
+
+// ---------------------------------------------------------------------------
+// main
+// ---------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    FILE* input  = stdin;
+    FILE* output = stdout;
+
+    if(argc > 1) {
+        input = ::fopen(argv[1], "rb");
+        if(input == nullptr) {
+            ::fprintf(stderr, "error: unable to open '%s'\n", argv[1]);
+            return EXIT_FAILURE;
+        }
+    }
+    if(argc > 2) {
+        output = ::fopen(argv[2], "wb");
+        if(output == nullptr) {
+            ::fprintf(stderr, "error: unable to open '%s'\n", argv[2]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::vector<uint8_t> stream;
+    /* read the stream */ {
+        uint8_t buffer[4096];
+        size_t  count = 0;
+        while((count = ::fread(buffer, 1, sizeof(buffer), input)) > 0) {
+            stream.insert(stream.end(), buffer, buffer + count);
+        }
+    }
+
+    Bitmap bitmap;
+    /* render the stream */ {
+        Renderer renderer(bitmap);
+        if(renderer.parse(stream.data(), stream.size()) == false) {
+            ::fprintf(stderr, "warning: the stream ends inside a command\n");
+        }
+        renderer.finish();
+    }
+    if(bitmap.save(output) == false) {
+        ::fprintf(stderr, "error: unable to write the bitmap\n");
+        return EXIT_FAILURE;
+    }
+    if(input != stdin) {
+        (void) ::fclose(input);
+    }
+    if(output != stdout) {
+        (void) ::fclose(output);
+    }
+    return EXIT_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// End-Of-File
+// ---------------------------------------------------------------------------
@@ -0,0 +1,611 @@
+/*
+ * ThermalPrinterRender.h - Copyright (c) 2014-2025 - Olivier Poncet
+ *
+ * This file is part of the CSN-A2 library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __INO_CSN_A2_ThermalPrinterRender_h__
+#define __INO_CSN_A2_ThermalPrinterRender_h__
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+// ASCII
+// ---------------------------------------------------------------------------
+
+namespace {
+
+struct ASCII
+{
+    static constexpr uint8_t NUL = 0x00; // null character
+    static constexpr uint8_t LF  = 0x0a; // new line
+    static constexpr uint8_t CR  = 0x0d; // carriage return
+    static constexpr uint8_t DC2 = 0x12; // device control 2
+    static constexpr uint8_t ESC = 0x1b; // escape
+    static constexpr uint8_t GS  = 0x1d; // group separator
+};
+
+}
+
+// ---------------------------------------------------------------------------
+// Traits
+// ---------------------------------------------------------------------------
+
+namespace {
+
+struct Traits
+{
+    struct Printer
+    {
+        static constexpr unsigned int dotsPerLine  = 384;
+        static constexpr unsigned int bytesPerLine = (dotsPerLine / 8);
+        static constexpr unsigned int lineSpacing  = 32;
+    };
+
+    struct FontA
+    {
+        static constexpr unsigned int charWidth  = 12;
+        static constexpr unsigned int charHeight = 24;
+    };
+
+    struct FontB
+    {
+        static constexpr unsigned int charWidth  =  9;
+        static constexpr unsigned int charHeight = 17;
+    };
+
+    struct Glyph
+    {
+        static constexpr unsigned int width  = 5;
+        static constexpr unsigned int height = 7;
+    };
+};
+
+}
+
+// ---------------------------------------------------------------------------
+// Font (5x7, column-major, bit 0 is the top row, characters 0x20 to 0x7f)
+// ---------------------------------------------------------------------------
+
+namespace {
+
+const uint8_t font5x7[96][5] = {
+    { 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x5f, 0x00, 0x00 },
+    { 0x00, 0x07, 0x00, 0x07, 0x00 }, { 0x14, 0x7f, 0x14, 0x7f, 0x14 },
+    { 0x24, 0x2a, 0x7f, 0x2a, 0x12 }, { 0x23, 0x13, 0x08, 0x64, 0x62 },
+    { 0x36, 0x49, 0x55, 0x22, 0x50 }, { 0x00, 0x05, 0x03, 0x00, 0x00 },
+    { 0x00, 0x1c, 0x22, 0x41, 0x00 }, { 0x00, 0x41, 0x22, 0x1c, 0x00 },
+    { 0x08, 0x2a, 0x1c, 0x2a, 0x08 }, { 0x08, 0x08, 0x3e, 0x08, 0x08 },
+    { 0x00, 0x50, 0x30, 0x00, 0x00 }, { 0x08, 0x08, 0x08, 0x08, 0x08 },
+    { 0x00, 0x60, 0x60, 0x00, 0x00 }, { 0x20, 0x10, 0x08, 0x04, 0x02 },
+    { 0x3e, 0x51, 0x49, 0x45, 0x3e }, { 0x00, 0x42, 0x7f, 0x40, 0x00 },
+    { 0x42, 0x61, 0x51, 0x49, 0x46 }, { 0x21, 0x41, 0x45, 0x4b, 0x31 },
+    { 0x18, 0x14, 0x12, 0x7f, 0x10 }, { 0x27, 0x45, 0x45, 0x45, 0x39 },
+    { 0x3c, 0x4a, 0x49, 0x49, 0x30 }, { 0x01, 0x71, 0x09, 0x05, 0x03 },
+    { 0x36, 0x49, 0x49, 0x49, 0x36 }, { 0x06, 0x49, 0x49, 0x29, 0x1e },
+    { 0x00, 0x36, 0x36, 0x00, 0x00 }, { 0x00, 0x56, 0x36, 0x00, 0x00 },
+    { 0x08, 0x14, 0x22, 0x41, 0x00 }, { 0x14, 0x14, 0x14, 0x14, 0x14 },
+    { 0x00, 0x41, 0x22, 0x14, 0x08 }, { 0x02, 0x01, 0x51, 0x09, 0x06 },
+    { 0x32, 0x49, 0x79, 0x41, 0x3e }, { 0x7e, 0x11, 0x11, 0x11, 0x7e },
+    { 0x7f, 0x49, 0x49, 0x49, 0x36 }, { 0x3e, 0x41, 0x41, 0x41, 0x22 },
+    { 0x7f, 0x41, 0x41, 0x22, 0x1c }, { 0x7f, 0x49, 0x49, 0x49, 0x41 },
+    { 0x7f, 0x09, 0x09, 0x01, 0x01 }, { 0x3e, 0x41, 0x41, 0x51, 0x32 },
+    { 0x7f, 0x08, 0x08, 0x08, 0x7f }, { 0x00, 0x41, 0x7f, 0x41, 0x00 },
+    { 0x20, 0x40, 0x41, 0x3f, 0x01 }, { 0x7f, 0x08, 0x14, 0x22, 0x41 },
+    { 0x7f, 0x40, 0x40, 0x40, 0x40 }, { 0x7f, 0x02, 0x04, 0x02, 0x7f },
+    { 0x7f, 0x04, 0x08, 0x10, 0x7f }, { 0x3e, 0x41, 0x41, 0x41, 0x3e },
+    { 0x7f, 0x09, 0x09, 0x09, 0x06 }, { 0x3e, 0x41, 0x51, 0x21, 0x5e },
+    { 0x7f, 0x09, 0x19, 0x29, 0x46 }, { 0x46, 0x49, 0x49, 0x49, 0x31 },
+    { 0x01, 0x01, 0x7f, 0x01, 0x01 }, { 0x3f, 0x40, 0x40, 0x40, 0x3f },
+    { 0x1f, 0x20, 0x40, 0x20, 0x1f }, { 0x7f, 0x20, 0x18, 0x20, 0x7f },
+    { 0x63, 0x14, 0x08, 0x14, 0x63 }, { 0x03, 0x04, 0x78, 0x04, 0x03 },
+    { 0x61, 0x51, 0x49, 0x45, 0x43 }, { 0x00, 0x7f, 0x41, 0x41, 0x00 },
+    { 0x02, 0x04, 0x08, 0x10, 0x20 }, { 0x00, 0x41, 0x41, 0x7f, 0x00 },
+    { 0x04, 0x02, 0x01, 0x02, 0x04 }, { 0x40, 0x40, 0x40, 0x40, 0x40 },
+    { 0x00, 0x01, 0x02, 0x04, 0x00 }, { 0x20, 0x54, 0x54, 0x54, 0x78 },
+    { 0x7f, 0x48, 0x44, 0x44, 0x38 }, { 0x38, 0x44, 0x44, 0x44, 0x20 },
+    { 0x38, 0x44, 0x44, 0x48, 0x7f }, { 0x38, 0x54, 0x54, 0x54, 0x18 },
+    { 0x08, 0x7e, 0x09, 0x01, 0x02 }, { 0x08, 0x14, 0x54, 0x54, 0x3c },
+    { 0x7f, 0x08, 0x04, 0x04, 0x78 }, { 0x00, 0x44, 0x7d, 0x40, 0x00 },
+    { 0x20, 0x40, 0x44, 0x3d, 0x00 }, { 0x00, 0x7f, 0x10, 0x28, 0x44 },
+    { 0x00, 0x41, 0x7f, 0x40, 0x00 }, { 0x7c, 0x04, 0x18, 0x04, 0x78 },
+    { 0x7c, 0x08, 0x04, 0x04, 0x78 }, { 0x38, 0x44, 0x44, 0x44, 0x38 },
+    { 0x7c, 0x14, 0x14, 0x14, 0x08 }, { 0x08, 0x14, 0x14, 0x18, 0x7c },
+    { 0x7c, 0x08, 0x04, 0x04, 0x08 }, { 0x48, 0x54, 0x54, 0x54, 0x20 },
+    { 0x04, 0x3f, 0x44, 0x40, 0x20 }, { 0x3c, 0x40, 0x40, 0x20, 0x7c },
+    { 0x1c, 0x20, 0x40, 0x20, 0x1c }, { 0x3c, 0x40, 0x30, 0x40, 0x3c },
+    { 0x44, 0x28, 0x10, 0x28, 0x44 }, { 0x0c, 0x50, 0x50, 0x50, 0x3c },
+    { 0x44, 0x64, 0x54, 0x4c, 0x44 }, { 0x00, 0x08, 0x36, 0x41, 0x00 },
+    { 0x00, 0x00, 0x7f, 0x00, 0x00 }, { 0x00, 0x41, 0x36, 0x08, 0x00 },
+    { 0x08, 0x04, 0x08, 0x10, 0x08 }, { 0x7f, 0x7f, 0x7f, 0x7f, 0x7f },
+};
+
+}
+
+// ---------------------------------------------------------------------------
+// Bitmap
+// ---------------------------------------------------------------------------
+
+namespace {
+
+class Bitmap
+{
+public: // public interface
+    Bitmap()
+        : _rows(0)
+        , _data()
+    {
+    }
+
+    unsigned int rows() const
+    {
+        return _rows;
+    }
+
+    void grow(const unsigned int rows)
+    {
+        if(rows > _rows) {
+            _rows = rows;
+            _data.resize(_rows * Traits::Printer::bytesPerLine, 0x00);
+        }
+    }
+
+    void set(const unsigned int x, const unsigned int y)
+    {
+        if(x < Traits::Printer::dotsPerLine) {
+            grow(y + 1);
+            _data[(y * Traits::Printer::bytesPerLine) + (x / 8)] |= (0x80 >> (x % 8));
+        }
+    }
+
+    void invert(const unsigned int x, const unsigned int y)
+    {
+        if(x < Traits::Printer::dotsPerLine) {
+            grow(y + 1);
+            _data[(y * Traits::Printer::bytesPerLine) + (x / 8)] ^= (0x80 >> (x % 8));
+        }
+    }
+
+    void fill(const unsigned int x, const unsigned int y, const unsigned int w, const unsigned int h)
+    {
+        for(unsigned int row = 0; row < h; ++row) {
+            for(unsigned int col = 0; col < w; ++col) {
+                set(x + col, y + row);
+            }
+        }
+    }
+
+    bool save(FILE* stream) const
+    {
+        if(::fprintf(stream, "P4\n%u %u\n", Traits::Printer::dotsPerLine, _rows) < 0) {
+            return false;
+        }
+        if(::fwrite(_data.data(), 1, _data.size(), stream) != _data.size()) {
+            return false;
+        }
+        return true;
+    }
+
+private: // private data
+    unsigned int         _rows;
+    std::vector<uint8_t> _data;
+};
+
+}
+
+// ---------------------------------------------------------------------------
+// Renderer
+// ---------------------------------------------------------------------------
+
+namespace {
+
+class Renderer
+{
+public: // public interface
+    Renderer(Bitmap& bitmap)
+        : _bitmap(bitmap)
+        , _line()
+        , _position(0)
+    {
+        reset();
+    }
+
+    virtual ~Renderer() = default;
+
+    bool parse(const uint8_t* data, const size_t size);
+
+    void finish();
+
+protected: // protected interface
+    virtual void command(const uint8_t* data, const size_t length)
+    {
+        (void) data;
+        (void) length;
+    }
+
+    size_t commandLength(const uint8_t* data, const size_t size) const;
+
+    void execute(const uint8_t* data, const size_t length);
+
+    struct Glyph
+    {
+        uint8_t character;
+        uint8_t printMode;
+        uint8_t underline;
+        bool    reverse;
+    };
+
+    void reset();
+
+    void printLine();
+
+    void feed(const unsigned int rows);
+
+    void drawGlyph(const Glyph& glyph, const unsigned int x, const unsigned int baseline);
+
+    void drawBarcode(const uint8_t* data, const size_t length);
+
+    void drawRaster(const uint8_t* data, const unsigned int rows, const unsigned int bytes);
+
+    unsigned int glyphWidth(const Glyph& glyph) const;
+
+    unsigned int glyphHeight(const Glyph& glyph) const;
+
+    unsigned int lineWidth() const;
+
+private: // private data
+    Bitmap&            _bitmap;
+    std::vector<Glyph> _line;
+    unsigned int       _position;
+    uint8_t            _printMode;
+    uint8_t            _justification;
+    uint8_t            _underline;
+    uint8_t            _lineSpacing;
+    uint8_t            _charSpacing;
+    uint8_t            _barcodeLabel;
+    uint8_t            _barcodeWidth;
+    uint8_t            _barcodeHeight;
+    bool               _reverse;
+};
+
+void Renderer::reset()
+{
+    _printMode     = 0;
+    _justification = 0;
+    _underline     = 0;
+    _lineSpacing   = Traits::Printer::lineSpacing;
+    _charSpacing   = 0;
+    _barcodeLabel  = 0;
+    _barcodeWidth  = 3;
+    _barcodeHeight = 162;
+    _reverse       = false;
+}
+
+bool Renderer::parse(const uint8_t* data, const size_t size)
+{
+    size_t index = 0;
+
+    while(index < size) {
+        const size_t length = commandLength(&data[index], (size - index));
+        if(length == 0) {
+            return false;
+        }
+        execute(&data[index], length);
+        command(&data[index], length);
+        index += length;
+    }
+    return true;
+}
+
+size_t Renderer::commandLength(const uint8_t* data, const size_t size) const
+{
+    size_t length = 1;
+
+    if((data[0] == ASCII::ESC) || (data[0] == ASCII::GS) || (data[0] == ASCII::DC2)) {
+        if(size < 2) {
+            return 0;
+        }
+        length = 2;
+        switch((data[0] << 8) | data[1]) {
+            case (ASCII::ESC << 8) | '7': // printing parameters
+                length += 3;
+                break;
+            case (ASCII::ESC << 8) | '8': // sleep
+                length += 2;
+                break;
+            case (ASCII::ESC << 8) | 'd': // print and feed lines
+            case (ASCII::ESC << 8) | 'J': // print and feed rows
+            case (ASCII::ESC << 8) | 'a': // justification
+            case (ASCII::ESC << 8) | '!': // print mode
+            case (ASCII::ESC << 8) | '-': // underline
+            case (ASCII::ESC << 8) | ' ': // character spacing
+            case (ASCII::ESC << 8) | '3': // line spacing
+            case (ASCII::ESC << 8) | '{': // upside-down
+            case (ASCII::ESC << 8) | '=': // peripheral device
+            case (ASCII::ESC << 8) | 'G': // double strike
+            case (ASCII::ESC << 8) | 'R': // character set
+            case (ASCII::ESC << 8) | 't': // character page
+            case (ASCII::ESC << 8) | 'v': // printer status
+            case (ASCII::GS  << 8) | 'B': // reverse
+            case (ASCII::GS  << 8) | 'H': // barcode label
+            case (ASCII::GS  << 8) | 'w': // barcode width
+            case (ASCII::GS  << 8) | 'h': // barcode height
+            case (ASCII::GS  << 8) | 'I': // printer id
+            case (ASCII::DC2 << 8) | '#': // printing density
+                length += 1;
+                break;
+            case (ASCII::GS << 8) | 'k': // print barcode
+                length += 2;
+                if(size >= length) {
+                    length += data[3];
+                }
+                break;
+            case (ASCII::DC2 << 8) | '*': // print raster bitmap
+                length += 2;
+                if(size >= length) {
+                    length += (data[2] * data[3]);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    return (size >= length ? length : 0);
+}
+
+void Renderer::execute(const uint8_t* data, const size_t length)
+{
+    if(length == 1) {
+        const uint8_t character = data[0];
+        if(character == ASCII::LF) {
+            if(_line.empty() != false) {
+                feed(_lineSpacing);
+            }
+            printLine();
+        }
+        else if((character >= 0x20) && (character != 0xff)) {
+            const Glyph glyph = { character, _printMode, _underline, _reverse };
+            if((lineWidth() + glyphWidth(glyph)) > Traits::Printer::dotsPerLine) {
+                printLine();
+            }
+            _line.push_back(glyph);
+        }
+        return;
+    }
+    switch((data[0] << 8) | data[1]) {
+        case (ASCII::ESC << 8) | '@': // reset
+            printLine();
+            reset();
+            break;
+        case (ASCII::ESC << 8) | 'd': // print and feed lines
+            printLine();
+            feed(data[2] * _lineSpacing);
+            break;
+        case (ASCII::ESC << 8) | 'J': // print and feed rows
+            printLine();
+            feed(data[2]);
+            break;
+        case (ASCII::ESC << 8) | 'a': // justification
+            _justification = (data[2] % 48) % 3;
+            break;
+        case (ASCII::ESC << 8) | '!': // print mode
+            _printMode = data[2];
+            break;
+        case (ASCII::ESC << 8) | '-': // underline
+            _underline = (data[2] % 48) % 3;
+            break;
+        case (ASCII::ESC << 8) | ' ': // character spacing
+            _charSpacing = data[2];
+            break;
+        case (ASCII::ESC << 8) | '3': // line spacing
+            _lineSpacing = data[2];
+            break;
+        case (ASCII::GS << 8) | 'B': // reverse
+            _reverse = (data[2] & 1) != 0;
+            break;
+        case (ASCII::GS << 8) | 'H': // barcode label
+            _barcodeLabel = (data[2] % 48) % 4;
+            break;
+        case (ASCII::GS << 8) | 'w': // barcode width
+            _barcodeWidth = data[2];
+            break;
+        case (ASCII::GS << 8) | 'h': // barcode height
+            _barcodeHeight = data[2];
+            break;
+        case (ASCII::GS << 8) | 'k': // print barcode
+            printLine();
+            drawBarcode(&data[4], data[3]);
+            break;
+        case (ASCII::DC2 << 8) | '*': // print raster bitmap
+            printLine();
+            drawRaster(&data[4], data[2], data[3]);
+            break;
+        default:
+            break;
+    }
+}
+
+void Renderer::finish()
+{
+    printLine();
+    _bitmap.grow(_position);
+}
+
+void Renderer::printLine()
+{
+    unsigned int height = 0;
+    for(const Glyph& glyph : _line) {
+        const unsigned int glyphRows = glyphHeight(glyph);
+        height = (glyphRows > height ? glyphRows : height);
+    }
+    if(height == 0) {
+        return;
+    }
+    /* draw the glyphs */ {
+        const unsigned int width = lineWidth();
+        unsigned int x = 0;
+        switch(_justification) {
+            case 1:
+                x = (Traits::Printer::dotsPerLine - width) / 2;
+                break;
+            case 2:
+                x = (Traits::Printer::dotsPerLine - width);
+                break;
+            default:
+                break;
+        }
+        for(const Glyph& glyph : _line) {
+            drawGlyph(glyph, x, _position + height);
+            x += glyphWidth(glyph);
+        }
+    }
+    _line.clear();
+    feed(height > _lineSpacing ? height : _lineSpacing);
+}
+
+void Renderer::feed(const unsigned int rows)
+{
+    _position += rows;
+    _bitmap.grow(_position);
+}
+
+void Renderer::drawGlyph(const Glyph& glyph, const unsigned int x, const unsigned int baseline)
+{
+    const bool         fontB   = ((glyph.printMode & (1 << 0)) != 0);
+    const bool         reverse = ((glyph.printMode & (1 << 1)) != 0) || glyph.reverse;
+    const bool         strike  = ((glyph.printMode & (1 << 6)) != 0);
+    const unsigned int cellW   = glyphWidth(glyph) - _charSpacing;
+    const unsigned int cellH   = glyphHeight(glyph);
+    const unsigned int scaleW  = (cellW - 2) / Traits::Glyph::width;
+    const unsigned int scaleH  = (cellH - 3) / Traits::Glyph::height;
+    const unsigned int top     = (baseline - cellH);
+    const uint8_t*     columns = font5x7[(glyph.character < 0x80 ? glyph.character : 0x7f) - 0x20];
+
+    for(unsigned int col = 0; col < Traits::Glyph::width; ++col) {
+        for(unsigned int row = 0; row < Traits::Glyph::height; ++row) {
+            if((columns[col] & (1 << row)) != 0) {
+                _bitmap.fill((x + 1 + (col * scaleW)), (top + 1 + (row * scaleH)), scaleW, scaleH);
+            }
+        }
+    }
+    if(glyph.underline != 0) {
+        _bitmap.fill(x, (baseline - glyph.underline), cellW, glyph.underline);
+    }
+    if(strike != false) {
+        _bitmap.fill(x, (top + (cellH / 2)), cellW, (fontB ? 1 : 2));
+    }
+    if(reverse != false) {
+        for(unsigned int row = 0; row < cellH; ++row) {
+            for(unsigned int col = 0; col < cellW; ++col) {
+                _bitmap.invert((x + col), (top + row));
+            }
+        }
+    }
+}
+
+void Renderer::drawBarcode(const uint8_t* data, const size_t length)
+{
+    const unsigned int module = (_barcodeWidth < 2 || _barcodeWidth > 6 ? 3 : _barcodeWidth);
+    const unsigned int height = (_barcodeHeight != 0 ? _barcodeHeight : 162);
+    const unsigned int width  = ((length * 11) + 35) * module;
+    unsigned int       x      = 0;
+
+    switch(_justification) {
+        case 1:
+            x = (width < Traits::Printer::dotsPerLine ? (Traits::Printer::dotsPerLine - width) / 2 : 0);
+            break;
+        case 2:
+            x = (width < Traits::Printer::dotsPerLine ? (Traits::Printer::dotsPerLine - width) : 0);
+            break;
+        default:
+            break;
+    }
+    /* label above */ {
+        if((_barcodeLabel & 1) != 0) {
+            feed(Traits::FontA::charHeight);
+        }
+    }
+    /* quiet start (2 modules), one 11-module pattern per byte, quiet end */ {
+        unsigned int offset = x + (2 * module);
+        for(size_t index = 0; index < length; ++index) {
+            const unsigned int pattern = (0x401 | (data[index] << 1));
+            for(unsigned int bit = 0; bit < 11; ++bit) {
+                if((pattern & (1 << (10 - bit))) != 0) {
+                    _bitmap.fill(offset, _position, module, height);
+                }
+                offset += module;
+            }
+        }
+    }
+    feed(height);
+    /* label below */ {
+        if((_barcodeLabel & 2) != 0) {
+            feed(Traits::FontA::charHeight);
+        }
+    }
+}
+
+void Renderer::drawRaster(const uint8_t* data, const unsigned int rows, const unsigned int bytes)
+{
+    for(unsigned int row = 0; row < rows; ++row) {
+        for(unsigned int byte = 0; byte < bytes; ++byte) {
+            const uint8_t value = data[(row * bytes) + byte];
+            for(unsigned int bit = 0; bit < 8; ++bit) {
+                if((value & (0x80 >> bit)) != 0) {
+                    _bitmap.set(((byte * 8) + bit), (_position + row));
+                }
+            }
+        }
+    }
+    feed(rows);
+}
+
+unsigned int Renderer::glyphWidth(const Glyph& glyph) const
+{
+    const bool         fontB = ((glyph.printMode & (1 << 0)) != 0);
+    const bool         wide  = ((glyph.printMode & (1 << 5)) != 0);
+    const unsigned int width = (fontB ? Traits::FontB::charWidth : Traits::FontA::charWidth);
+
+    return (width << (wide ? 1 : 0)) + _charSpacing;
+}
+
+unsigned int Renderer::glyphHeight(const Glyph& glyph) const
+{
+    const bool         fontB  = ((glyph.printMode & (1 << 0)) != 0);
+    const bool         tall   = ((glyph.printMode & (1 << 4)) != 0);
+    const unsigned int height = (fontB ? Traits::FontB::charHeight : Traits::FontA::charHeight);
+
+    return (height << (tall ? 1 : 0));
+}
+
+unsigned int Renderer::lineWidth() const
+{
+    unsigned int width = 0;
+    for(const Glyph& glyph : _line) {
+        width += glyphWidth(glyph);
+    }
+    return width;
+}
+
+}
+
+// ---------------------------------------------------------------------------
+// End-Of-File
+// ---------------------------------------------------------------------------
+
+#endif /* __INO_CSN_A2_ThermalPrinterRender_h__ */
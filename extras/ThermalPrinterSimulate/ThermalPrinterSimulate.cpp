@@ -0,0 +1,471 @@
+/*
+ * ThermalPrinterSimulate.cpp - Copyright (c) 2014-2025 - Olivier Poncet
+ *
+ * This file is part of the CSN-A2 library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Host-side model of the CSN-A2 receive buffer fed by a captured stream.
+ *
+ * build : c++ -std=c++11 -O2 -o ThermalPrinterSimulate ThermalPrinterSimulate.cpp
+ * usage : ThermalPrinterSimulate [-b baud] [-s size] [-p dotPrintTime] [-f dotFeedTime] [input.txt]
+ *
+ * The input is a serial log, the lines starting with 'tx' are parsed and
+ * everything else is ignored. Each line holds the micros() timestamp of a
+ * write to the printer port followed by the written bytes in hexadecimal,
+ * e.g. "tx 123456 1b 40", as logged by a Stream wrapper around the port.
+ *
+ * The bytes are clocked on the wire at the given baud rate, stored into a
+ * receive buffer of the given size and consumed by the mechanism, which is
+ * busy for the dot print/feed times (in microseconds per dot row) of each
+ * printed line, feed, barcode and bitmap. Every byte arriving while the
+ * buffer is full is reported as an overflow and the exit status is then
+ * EXIT_FAILURE, so the times given to setPrintingSpeed() can be checked
+ * against a capture before trusting them on a unit.
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+// ASCII
+// ---------------------------------------------------------------------------
+
+namespace {
+
+struct ASCII
+{
+    static constexpr uint8_t LF  = 0x0a; // new line
+    static constexpr uint8_t DC2 = 0x12; // device control 2
+    static constexpr uint8_t ESC = 0x1b; // escape
+    static constexpr uint8_t GS  = 0x1d; // group separator
+};
+
+}
+
+// ---------------------------------------------------------------------------
+// Traits
+// ---------------------------------------------------------------------------
+
+namespace {
+
+struct Traits
+{
+    struct Printer
+    {
+        static constexpr unsigned long serialBaudRate = 19200;
+        static constexpr unsigned long bufferSize     = 1024;
+        static constexpr unsigned int  dotsPerLine    = 384;
+        static constexpr unsigned int  lineSpacing    = 32;
+    };
+
+    struct FontA
+    {
+        static constexpr unsigned int charWidth  = 12;
+        static constexpr unsigned int charHeight = 24;
+    };
+
+    struct FontB
+    {
+        static constexpr unsigned int charWidth  =  9;
+        static constexpr unsigned int charHeight = 17;
+    };
+};
+
+}
+
+// ---------------------------------------------------------------------------
+// Mechanism
+// ---------------------------------------------------------------------------
+
+namespace {
+
+class Mechanism
+{
+public: // public interface
+    Mechanism(const unsigned long dotPrintTime, const unsigned long dotFeedTime)
+        : _dotPrintTime(dotPrintTime)
+        , _dotFeedTime(dotFeedTime)
+        , _printMode(0)
+        , _lineSpacing(Traits::Printer::lineSpacing)
+        , _barcodeHeight(162)
+        , _lineWidth(0)
+        , _lineHeight(0)
+    {
+    }
+
+    size_t length(const uint8_t* data, const size_t size) const;
+
+    unsigned long consume(const uint8_t* data, const size_t length);
+
+private: // private interface
+    unsigned long printLine();
+
+    unsigned long rows(const unsigned long printed, const unsigned long fed) const
+    {
+        return (printed * _dotPrintTime) + (fed * _dotFeedTime);
+    }
+
+private: // private data
+    const unsigned long _dotPrintTime;
+    const unsigned long _dotFeedTime;
+    uint8_t             _printMode;
+    uint8_t             _lineSpacing;
+    uint8_t             _barcodeHeight;
+    unsigned int        _lineWidth;
+    unsigned int        _lineHeight;
+};
+
+size_t Mechanism::length(const uint8_t* data, const size_t size) const
+{
+    size_t length = 1;
+
+    if((data[0] == ASCII::ESC) || (data[0] == ASCII::GS) || (data[0] == ASCII::DC2)) {
+        if(size < 2) {
+            return 0;
+        }
+        length = 2;
+        switch((data[0] << 8) | data[1]) {
+            case (ASCII::ESC << 8) | '7':
+                length += 3;
+                break;
+            case (ASCII::ESC << 8) | '8':
+                length += 2;
+                break;
+            case (ASCII::ESC << 8) | 'd':
+            case (ASCII::ESC << 8) | 'J':
+            case (ASCII::ESC << 8) | 'a':
+            case (ASCII::ESC << 8) | '!':
+            case (ASCII::ESC << 8) | '-':
+            case (ASCII::ESC << 8) | ' ':
+            case (ASCII::ESC << 8) | '3':
+            case (ASCII::ESC << 8) | '{':
+            case (ASCII::ESC << 8) | '=':
+            case (ASCII::ESC << 8) | 'G':
+            case (ASCII::ESC << 8) | 'R':
+            case (ASCII::ESC << 8) | 't':
+            case (ASCII::ESC << 8) | 'v':
+            case (ASCII::GS  << 8) | 'B':
+            case (ASCII::GS  << 8) | 'H':
+            case (ASCII::GS  << 8) | 'w':
+            case (ASCII::GS  << 8) | 'h':
+            case (ASCII::GS  << 8) | 'I':
+            case (ASCII::DC2 << 8) | '#':
+                length += 1;
+                break;
+            case (ASCII::GS << 8) | 'k':
+                length += 2;
+                if(size >= length) {
+                    length += data[3];
+                }
+                break;
+            case (ASCII::DC2 << 8) | '*':
+                length += 2;
+                if(size >= length) {
+                    length += (data[2] * data[3]);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    return (size >= length ? length : 0);
+}
+
+unsigned long Mechanism::consume(const uint8_t* data, const size_t length)
+{
+    switch(length == 1 ? data[0] : ((data[0] << 8) | data[1])) {
+        case ASCII::LF:
+            return printLine();
+        case (ASCII::ESC << 8) | '@':
+            _printMode     = 0;
+            _lineSpacing   = Traits::Printer::lineSpacing;
+            _barcodeHeight = 162;
+            return 0;
+        case (ASCII::ESC << 8) | '!':
+            _printMode = data[2];
+            return 0;
+        case (ASCII::ESC << 8) | '3':
+            _lineSpacing = data[2];
+            return 0;
+        case (ASCII::GS << 8) | 'h':
+            _barcodeHeight = data[2];
+            return 0;
+        case (ASCII::ESC << 8) | 'J':
+            return printLine() + rows(0, data[2]);
+        case (ASCII::ESC << 8) | 'd':
+            return printLine() + rows(0, (data[2] * _lineSpacing));
+        case (ASCII::GS << 8) | 'k':
+            return printLine() + rows(_barcodeHeight, 0);
+        case (ASCII::DC2 << 8) | '*':
+            return printLine() + rows(data[2], 0);
+        default:
+            break;
+    }
+    if((length == 1) && (data[0] >= 0x20)) {
+        const bool         fontB  = ((_printMode & (1 << 0)) != 0);
+        const bool         tall   = ((_printMode & (1 << 4)) != 0);
+        const bool         wide   = ((_printMode & (1 << 5)) != 0);
+        const unsigned int width  = ((fontB ? Traits::FontB::charWidth  : Traits::FontA::charWidth ) << (wide ? 1 : 0));
+        const unsigned int height = ((fontB ? Traits::FontB::charHeight : Traits::FontA::charHeight) << (tall ? 1 : 0));
+        unsigned long      time   = 0;
+        if((_lineWidth + width) > Traits::Printer::dotsPerLine) {
+            time = printLine();
+        }
+        _lineWidth  += width;
+        _lineHeight  = (height > _lineHeight ? height : _lineHeight);
+        return time;
+    }
+    return 0;
+}
+
+unsigned long Mechanism::printLine()
+{
+    const unsigned int printed = _lineHeight;
+    const unsigned int fed     = (_lineSpacing > printed ? (_lineSpacing - printed) : 0);
+
+    _lineWidth  = 0;
+    _lineHeight = 0;
+
+    return rows(printed, fed);
+}
+
+}
+
+// ---------------------------------------------------------------------------
+// Simulator
+// ---------------------------------------------------------------------------
+
+namespace {
+
+struct Report
+{
+    unsigned long bytes         = 0; // bytes received
+    unsigned long duration      = 0; // microseconds until the last byte is consumed
+    unsigned long peakOccupancy = 0; // highest buffer occupancy
+    unsigned long peakTime      = 0; // time of the highest occupancy
+    unsigned long overflows     = 0; // bytes received while the buffer is full
+    unsigned long firstOffset   = 0; // offset of the first overflowing byte
+    unsigned long firstTime     = 0; // time of the first overflowing byte
+};
+
+class Simulator
+{
+public: // public interface
+    Simulator(const unsigned long baudRate, const unsigned long bufferSize, Mechanism& mechanism)
+        : _byteTime(((8UL + 2UL) * 1000000UL) / baudRate)
+        , _bufferSize(bufferSize)
+        , _mechanism(mechanism)
+        , _arrivals()
+        , _data()
+        , _wire(0)
+    {
+    }
+
+    bool parse(FILE* input);
+
+    Report run();
+
+private: // private interface
+    static bool readLine(FILE* input, std::vector<char>& line);
+
+private: // private data
+    const unsigned long        _byteTime;
+    const unsigned long        _bufferSize;
+    Mechanism&                 _mechanism;
+    std::vector<unsigned long> _arrivals;
+    std::vector<uint8_t>       _data;
+    unsigned long              _wire;
+};
+
+bool Simulator::readLine(FILE* input, std::vector<char>& line)
+{
+    char chunk[256];
+
+    line.clear();
+    while(::fgets(chunk, sizeof(chunk), input) != nullptr) {
+        const size_t length = ::strlen(chunk);
+        line.insert(line.end(), chunk, (chunk + length));
+        if((length != 0) && (chunk[length - 1] == '\n')) {
+            break;
+        }
+    }
+    if(line.empty()) {
+        return false;
+    }
+    line.push_back('\0');
+    return true;
+}
+
+bool Simulator::parse(FILE* input)
+{
+    std::vector<char> line;
+    bool first = true;
+    unsigned long origin = 0;
+
+    while(readLine(input, line) != false) {
+        if(::strncmp(line.data(), "tx ", 3) != 0) {
+            continue;
+        }
+        char*         cursor = &line[3];
+        char*         end    = nullptr;
+        unsigned long time   = ::strtoul(cursor, &end, 10);
+        if(end == cursor) {
+            continue;
+        }
+        if(first != false) {
+            origin = time;
+            first  = false;
+        }
+        time = static_cast<uint32_t>(time - origin);
+        /* clock the bytes on the wire */ {
+            if(time > _wire) {
+                _wire = time;
+            }
+            for(cursor = end;;) {
+                const unsigned long value = ::strtoul(cursor, &end, 16);
+                if(end == cursor) {
+                    break;
+                }
+                _wire += _byteTime;
+                _arrivals.push_back(_wire);
+                _data.push_back(static_cast<uint8_t>(value));
+                cursor = end;
+            }
+        }
+    }
+    return _data.empty() == false;
+}
+
+Report Simulator::run()
+{
+    Report                     report;
+    std::vector<unsigned long> consumed(_data.size(), 0);
+    unsigned long              head = 0;
+
+    /* consume the commands once received and the mechanism is idle */ {
+        size_t index = 0;
+        while(index < _data.size()) {
+            size_t length = _mechanism.length(&_data[index], (_data.size() - index));
+            if(length == 0) {
+                length = (_data.size() - index);
+            }
+            for(size_t offset = 0; offset < length; ++offset) {
+                const unsigned long arrival = _arrivals[index + offset];
+                head = (arrival > head ? arrival : head);
+                consumed[index + offset] = head;
+            }
+            head  += _mechanism.consume(&_data[index], length);
+            index += length;
+        }
+    }
+    /* measure the occupancy seen by each arriving byte */ {
+        size_t drained = 0;
+        for(size_t index = 0; index < _data.size(); ++index) {
+            const unsigned long arrival = _arrivals[index];
+            while((drained < index) && (consumed[drained] <= arrival)) {
+                ++drained;
+            }
+            const unsigned long occupancy = (index - drained);
+            if(occupancy > report.peakOccupancy) {
+                report.peakOccupancy = occupancy;
+                report.peakTime      = arrival;
+            }
+            if(occupancy >= _bufferSize) {
+                if(report.overflows == 0) {
+                    report.firstOffset = index;
+                    report.firstTime   = arrival;
+                }
+                ++report.overflows;
+            }
+        }
+    }
+    report.bytes    = _data.size();
+    report.duration = head;
+    return report;
+}
+
+}
+
+// ---------------------------------------------------------------------------
+// main
+// ---------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    FILE*         input        = stdin;
+    unsigned long baudRate     = Traits::Printer::serialBaudRate;
+    unsigned long bufferSize   = Traits::Printer::bufferSize;
+    unsigned long dotPrintTime = 0;
+    unsigned long dotFeedTime  = 0;
+
+    for(int argi = 1; argi < argc; ++argi) {
+        const char* option = argv[argi];
+        if((::strcmp(option, "-b") == 0) && (argi + 1 < argc)) {
+            baudRate = ::strtoul(argv[++argi], nullptr, 10);
+        }
+        else if((::strcmp(option, "-s") == 0) && (argi + 1 < argc)) {
+            bufferSize = ::strtoul(argv[++argi], nullptr, 10);
+        }
+        else if((::strcmp(option, "-p") == 0) && (argi + 1 < argc)) {
+            dotPrintTime = ::strtoul(argv[++argi], nullptr, 10);
+        }
+        else if((::strcmp(option, "-f") == 0) && (argi + 1 < argc)) {
+            dotFeedTime = ::strtoul(argv[++argi], nullptr, 10);
+        }
+        else if(input == stdin) {
+            input = ::fopen(option, "r");
+            if(input == nullptr) {
+                ::fprintf(stderr, "error: unable to open '%s'\n", option);
+                return EXIT_FAILURE;
+            }
+        }
+    }
+    if((baudRate == 0) || (bufferSize == 0)) {
+        ::fprintf(stderr, "error: invalid baud rate or buffer size\n");
+        return EXIT_FAILURE;
+    }
+
+    Mechanism mechanism(dotPrintTime, dotFeedTime);
+    Simulator simulator(baudRate, bufferSize, mechanism);
+    if(simulator.parse(input) == false) {
+        ::fprintf(stderr, "error: no transmitted byte found\n");
+        return EXIT_FAILURE;
+    }
+    if(input != stdin) {
+        (void) ::fclose(input);
+    }
+
+    const Report report = simulator.run();
+    /* print the report */ {
+        ::fprintf(stdout, "bytes received : %lu\n", report.bytes);
+        ::fprintf(stdout, "job duration   : %lu us\n", report.duration);
+        ::fprintf(stdout, "peak occupancy : %lu/%lu bytes at %lu us\n", report.peakOccupancy, bufferSize, report.peakTime);
+        if(report.overflows != 0) {
+            ::fprintf(stdout, "overflows      : %lu bytes, first at offset %lu (%lu us)\n", report.overflows, report.firstOffset, report.firstTime);
+        }
+        else {
+            ::fprintf(stdout, "overflows      : none\n");
+        }
+    }
+    return (report.overflows != 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+// ---------------------------------------------------------------------------
+// End-Of-File
+// ---------------------------------------------------------------------------
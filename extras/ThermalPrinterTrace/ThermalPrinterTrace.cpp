@@ -0,0 +1,200 @@
+/*
+ * ThermalPrinterTrace.cpp - Copyright (c) 2014-2025 - Olivier Poncet
+ *
+ * This file is part of the CSN-A2 library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Host-side converter of the trace dumped by ThermalPrinter::dumpTrace().
+ *
+ * build : c++ -std=c++11 -O2 -o ThermalPrinterTrace ThermalPrinterTrace.cpp
+ * usage : ThermalPrinterTrace [input.txt [output.json]]
+ *
+ * The input is a serial log, the lines starting with 'trace' are parsed
+ * and everything else is ignored. The output is a Chrome trace (JSON) to
+ * be opened with chrome://tracing or https://ui.perfetto.dev, which show
+ * the nested calls as a timeline and a flame chart.
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+// Event
+// ---------------------------------------------------------------------------
+
+namespace {
+
+struct Event
+{
+    std::string   name;
+    uint32_t      enter;
+    uint32_t      leave;
+    unsigned long bytes;
+};
+
+}
+
+// ---------------------------------------------------------------------------
+// Parser
+// ---------------------------------------------------------------------------
+
+namespace {
+
+class Parser
+{
+public: // public interface
+    Parser(std::vector<Event>& events)
+        : _events(events)
+    {
+    }
+
+    void parse(FILE* input);
+
+private: // private data
+    std::vector<Event>& _events;
+};
+
+void Parser::parse(FILE* input)
+{
+    char line[256];
+
+    while(::fgets(line, sizeof(line), input) != nullptr) {
+        char          name[64];
+        unsigned long enter = 0;
+        unsigned long leave = 0;
+        unsigned long bytes = 0;
+        if(::sscanf(line, "trace %63s %lu %lu %lu", name, &enter, &leave, &bytes) == 4) {
+            Event event;
+            event.name  = name;
+            event.enter = static_cast<uint32_t>(enter);
+            event.leave = static_cast<uint32_t>(leave);
+            event.bytes = bytes;
+            _events.push_back(event);
+        }
+    }
+}
+
+}
+
+// ---------------------------------------------------------------------------
+// Writer
+// ---------------------------------------------------------------------------
+
+namespace {
+
+class Writer
+{
+public: // public interface
+    Writer(const std::vector<Event>& events)
+        : _events(events)
+    {
+    }
+
+    bool write(FILE* output) const;
+
+private: // private data
+    const std::vector<Event>& _events;
+};
+
+bool Writer::write(FILE* output) const
+{
+    long origin = 0;
+
+    /* find the earliest entry, micros() wraps around every 71 minutes */ {
+        for(const Event& event : _events) {
+            const long enter = static_cast<int32_t>(event.enter - _events.front().enter);
+            if(enter < origin) {
+                origin = enter;
+            }
+        }
+    }
+    /* write the events */ {
+        ::fprintf(output, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+        const char* separator = "\n";
+        for(const Event& event : _events) {
+            const long     enter    = static_cast<int32_t>(event.enter - _events.front().enter);
+            const uint32_t duration = (event.leave - event.enter);
+            ::fprintf ( output
+                      , "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%ld,\"dur\":%lu,\"args\":{\"bytes\":%lu}}"
+                      , separator
+                      , event.name.c_str()
+                      , (enter - origin)
+                      , static_cast<unsigned long>(duration)
+                      , event.bytes );
+            separator = ",\n";
+        }
+        ::fprintf(output, "\n]}\n");
+    }
+    return ::ferror(output) == 0;
+}
+
+}
+
+// ---------------------------------------------------------------------------
+// main
+// ---------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    FILE* input  = stdin;
+    FILE* output = stdout;
+
+    if(argc > 1) {
+        input = ::fopen(argv[1], "r");
+        if(input == nullptr) {
+            ::fprintf(stderr, "error: unable to open '%s'\n", argv[1]);
+            return EXIT_FAILURE;
+        }
+    }
+    if(argc > 2) {
+        output = ::fopen(argv[2], "w");
+        if(output == nullptr) {
+            ::fprintf(stderr, "error: unable to open '%s'\n", argv[2]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::vector<Event> events;
+    /* parse the trace */ {
+        Parser parser(events);
+        parser.parse(input);
+    }
+    if(events.empty() != false) {
+        ::fprintf(stderr, "error: no trace event found\n");
+        return EXIT_FAILURE;
+    }
+    /* write the trace */ {
+        const Writer writer(events);
+        if(writer.write(output) == false) {
+            ::fprintf(stderr, "error: unable to write the trace\n");
+            return EXIT_FAILURE;
+        }
+    }
+    if(input != stdin) {
+        (void) ::fclose(input);
+    }
+    if(output != stdout) {
+        (void) ::fclose(output);
+    }
+    return EXIT_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// End-Of-File
+// ---------------------------------------------------------------------------